@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "../library/algorithm.h"
+
+namespace {
+using containers::detail::simd_level;
+
+// The benchmark argument is the instruction set: 0 scalar, 1 SSE2, 2 AVX2, 3 AVX-512. Levels the
+// CPU lacks are skipped.
+bool SelectLevel(benchmark::State &state, simd_level &level) {
+    level = static_cast<simd_level>(state.range(0));
+    if (level > containers::detail::cpu_simd_level()) {
+        state.SkipWithError("instruction set is not supported");
+        return false;
+    }
+    return true;
+}
+
+constexpr size_t kCount = 1 << 16;
+}  // namespace
+
+template <typename T>
+static void BM_Find(benchmark::State &state) {
+    simd_level level;
+    if (!SelectLevel(state, level)) return;
+    std::vector<T> data(kCount, T(1));  // the value is missing, so the whole range is scanned
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(containers::detail::find(level, data.data(), data.size(), T(2)));
+    }
+    state.SetBytesProcessed(state.iterations() * kCount * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Find, uint8_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_Find, int32_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_Find, float)->DenseRange(0, 3);
+
+template <typename T>
+static void BM_Count(benchmark::State &state) {
+    simd_level level;
+    if (!SelectLevel(state, level)) return;
+    std::vector<T> data(kCount);
+    for (size_t i = 0; i < kCount; ++i) data[i] = T(i % 7);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(containers::detail::count(level, data.data(), data.size(), T(3)));
+    }
+    state.SetBytesProcessed(state.iterations() * kCount * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Count, uint8_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_Count, int32_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_Count, float)->DenseRange(0, 3);
+
+template <typename T>
+static void BM_MinElement(benchmark::State &state) {
+    simd_level level;
+    if (!SelectLevel(state, level)) return;
+    std::vector<T> data(kCount);
+    for (size_t i = 0; i < kCount; ++i) data[i] = T((i * 7919) % 101);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            containers::detail::extreme_index<false>(level, data.data(), data.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * kCount * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_MinElement, uint8_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_MinElement, int32_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_MinElement, float)->DenseRange(0, 3);
+
+template <typename T>
+static void BM_Equal(benchmark::State &state) {
+    simd_level level;
+    if (!SelectLevel(state, level)) return;
+    std::vector<T> left(kCount, T(5)), right(kCount, T(5));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            containers::detail::equal(level, left.data(), right.data(), kCount));
+    }
+    state.SetBytesProcessed(state.iterations() * kCount * sizeof(T) * 2);
+}
+BENCHMARK_TEMPLATE(BM_Equal, uint8_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_Equal, int32_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_Equal, float)->DenseRange(0, 3);
+
+template <typename T>
+static void BM_Fill(benchmark::State &state) {
+    simd_level level;
+    if (!SelectLevel(state, level)) return;
+    std::vector<T> data(kCount);
+    for (auto _ : state) {
+        containers::detail::fill(level, data.data(), data.size(), T(7));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kCount * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Fill, uint8_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_Fill, int32_t)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_Fill, float)->DenseRange(0, 3);
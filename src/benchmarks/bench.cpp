@@ -0,0 +1,5 @@
+#include <benchmark/benchmark.h>
+
+#include "../containers.h"
+
+BENCHMARK_MAIN();
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../library/concurrent_queue.h"
+#include "../library/queue.h"
+
+namespace {
+constexpr long kPerProducer = 1 << 15;
+
+// What each service writes today: one element per lock, a notify for every push and a consumer
+// that retries after every wakeup.
+class handwritten_queue {
+   public:
+    void push(long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push(value);
+        not_empty_.notify_one();
+    }
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+    }
+    bool pop_wait(long &value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (queue_.empty()) {
+            if (closed_) return false;
+            not_empty_.wait(lock);
+        }
+        value = queue_.front();
+        queue_.pop();
+        return true;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    containers::queue<long> queue_;
+    bool closed_ = false;
+};
+
+template <typename Queue, typename Consume>
+void Run(benchmark::State &state, Consume consume) {
+    const long producers = state.range(0);
+    const long consumers = state.range(1);
+    for (auto _ : state) {
+        Queue queue;
+        std::vector<std::thread> threads;
+        for (long c = 0; c < consumers; ++c) threads.emplace_back([&] { consume(queue); });
+        std::vector<std::thread> senders;
+        for (long p = 0; p < producers; ++p) {
+            senders.emplace_back([&queue] {
+                for (long i = 0; i < kPerProducer; ++i) queue.push(i);
+            });
+        }
+        for (auto &thread : senders) thread.join();
+        queue.close();
+        for (auto &thread : threads) thread.join();
+    }
+    state.SetItemsProcessed(state.iterations() * producers * kPerProducer);
+}
+
+template <typename Queue>
+void PopEach(Queue &queue) {
+    long sum = 0;
+    for (long value; queue.pop_wait(value);) sum += value;
+    benchmark::DoNotOptimize(sum);
+}
+
+void PopBatches(containers::concurrent_queue<long> &queue) {
+    std::vector<long> batch;
+    long sum = 0;
+    while (queue.pop_all(std::back_inserter(batch), 256) != 0) {
+        for (long value : batch) sum += value;
+        batch.clear();
+    }
+    benchmark::DoNotOptimize(sum);
+}
+}  // namespace
+
+// Messages per second from state.range(0) producers to state.range(1) consumers.
+static void BM_HandwrittenQueue(benchmark::State &state) {
+    Run<handwritten_queue>(state, PopEach<handwritten_queue>);
+}
+BENCHMARK(BM_HandwrittenQueue)->Args({1, 1})->Args({2, 2})->Args({4, 4})->UseRealTime();
+
+static void BM_ConcurrentQueuePopWait(benchmark::State &state) {
+    Run<containers::concurrent_queue<long>>(state, PopEach<containers::concurrent_queue<long>>);
+}
+BENCHMARK(BM_ConcurrentQueuePopWait)->Args({1, 1})->Args({2, 2})->Args({4, 4})->UseRealTime();
+
+static void BM_ConcurrentQueuePopAll(benchmark::State &state) {
+    Run<containers::concurrent_queue<long>>(state, PopBatches);
+}
+BENCHMARK(BM_ConcurrentQueuePopAll)->Args({1, 1})->Args({2, 2})->Args({4, 4})->UseRealTime();
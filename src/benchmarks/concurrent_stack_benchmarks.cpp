@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "../library/concurrent_stack.h"
+#include "../library/stack.h"
+
+namespace {
+constexpr int kBuffers = 64;
+
+// What the buffer pools do today: containers::stack behind a mutex.
+class locked_stack {
+   public:
+    void push(void *buffer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stack_.push(buffer);
+    }
+    bool try_pop(void *&buffer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stack_.empty()) return false;
+        buffer = stack_.top();
+        stack_.pop();
+        return true;
+    }
+
+   private:
+    std::mutex mutex_;
+    containers::stack<void *> stack_;
+};
+
+char buffers[kBuffers][64];
+}  // namespace
+
+// A free-buffer pool shared by all benchmark threads: take a buffer, touch it, give it back.
+template <typename Pool>
+static void BM_BufferPool(benchmark::State &state) {
+    static Pool *pool;
+    if (state.thread_index() == 0) {
+        pool = new Pool;
+        for (auto &buffer : buffers) pool->push(buffer);
+    }
+    for (auto _ : state) {
+        void *buffer;
+        if (pool->try_pop(buffer)) {
+            static_cast<char *>(buffer)[0] = 1;
+            pool->push(buffer);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) delete pool;
+}
+BENCHMARK_TEMPLATE(BM_BufferPool, locked_stack)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_BufferPool, containers::concurrent_stack<void *>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_BufferPool, containers::concurrent_stack<void *, 8>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
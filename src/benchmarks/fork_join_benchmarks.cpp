@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+#include "../library/fork_join.h"
+#include "../library/parallel.h"
+#include "../library/queue.h"
+#include "../library/vector.h"
+
+namespace {
+constexpr size_t kCount = 1 << 16;
+
+// Uneven batch job: the cost of an element grows with its index, so an even split leaves the
+// threads with the first chunks idle while the last one works.
+void Work(float &item, size_t index) {
+    size_t steps = 1 + index / 256;
+    for (size_t i = 0; i < steps; ++i) item = std::sqrt(item + static_cast<float>(i));
+}
+
+containers::vector<float> Values() {
+    containers::vector<float> values(kCount);
+    for (size_t i = 0; i < kCount; ++i) values[i] = static_cast<float>(i % 1024);
+    return values;
+}
+
+void ThreadCounts(benchmark::internal::Benchmark *bench) {
+    for (int threads : {1, 2, 4, 8}) bench->Arg(threads);
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    if (hardware != 1 && hardware != 2 && hardware != 4 && hardware != 8) bench->Arg(hardware);
+    bench->UseRealTime();
+}
+}  // namespace
+
+static void BM_ForkJoinParallelFor(benchmark::State &state) {
+    containers::parallel::fork_join_pool pool(state.range(0));
+    containers::vector<float> values = Values();
+    float *data = values.data();
+    for (auto _ : state) {
+        pool.parallel_for(0, kCount, [data](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) Work(data[i], i);
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(BM_ForkJoinParallelFor)->Apply(ThreadCounts);
+
+// The same job cut into one chunk per thread up front.
+static void BM_ThreadPoolChunks(benchmark::State &state) {
+    containers::parallel::thread_pool pool(state.range(0));
+    containers::vector<float> values = Values();
+    float *data = values.data();
+    size_t chunks = pool.size();
+    for (auto _ : state) {
+        pool.run(chunks, [&](size_t chunk) {
+            size_t end = kCount * (chunk + 1) / chunks;
+            for (size_t i = kCount * chunk / chunks; i < end; ++i) Work(data[i], i);
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(BM_ThreadPoolChunks)->Apply(ThreadCounts);
+
+// The same job as small tasks in one mutex-protected queue that every thread takes from.
+static void BM_CentralQueue(benchmark::State &state) {
+    constexpr size_t kGrain = 64;
+    containers::parallel::thread_pool pool(state.range(0));
+    containers::vector<float> values = Values();
+    float *data = values.data();
+    for (auto _ : state) {
+        containers::queue<size_t> tasks;
+        std::mutex mutex;
+        for (size_t begin = 0; begin < kCount; begin += kGrain) tasks.push(begin);
+        pool.run(pool.size(), [&](size_t) {
+            for (;;) {
+                size_t begin;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (tasks.empty()) return;
+                    begin = tasks.front();
+                    tasks.pop();
+                }
+                for (size_t i = begin; i < begin + kGrain; ++i) Work(data[i], i);
+            }
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(BM_CentralQueue)->Apply(ThreadCounts);
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "../library/intrusive_list.h"
+#include "../library/list.h"
+
+namespace {
+struct Connection {
+    long id = 0;
+    long last_seen = 0;
+    containers::intrusive_list_hook idle_hook;
+};
+}  // namespace
+
+// Idle connection tracking: activity on a connection moves it to the back of the idle list.
+// containers::list keeps a copy of every connection and allocates a node on every move.
+static void BM_ListIdleTouch(benchmark::State &state) {
+    using idle_list = containers::list<Connection>;
+    idle_list idle;
+    std::vector<idle_list::iterator> index;
+    for (long i = 0; i < state.range(0); ++i) {
+        Connection connection;
+        connection.id = i;
+        index.push_back(idle.insert(idle.end(), connection));
+    }
+    std::mt19937 random(42);
+    long now = 0;
+    for (auto _ : state) {
+        long id = random() % index.size();
+        Connection connection = *index[id];
+        connection.last_seen = ++now;
+        idle.erase(index[id]);
+        index[id] = idle.insert(idle.end(), connection);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ListIdleTouch)->Arg(1 << 10)->Arg(1 << 18);
+
+// The same with the links inside the pooled connections, nothing is allocated or copied.
+static void BM_IntrusiveListIdleTouch(benchmark::State &state) {
+    using idle_list = containers::intrusive_list<Connection, &Connection::idle_hook>;
+    std::vector<Connection> connections(state.range(0));
+    idle_list idle;
+    for (long i = 0; i < state.range(0); ++i) {
+        connections[i].id = i;
+        idle.push_back(connections[i]);
+    }
+    std::mt19937 random(42);
+    long now = 0;
+    for (auto _ : state) {
+        Connection &connection = connections[random() % connections.size()];
+        connection.last_seen = ++now;
+        connection.idle_hook.unlink();
+        idle.push_back(connection);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IntrusiveListIdleTouch)->Arg(1 << 10)->Arg(1 << 18);
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../library/list.h"
+#include "../library/node_pool.h"
+
+namespace {
+struct Order {
+    long id;
+    double price;
+    long quantity;
+};
+
+constexpr int kLevel = 1024;
+}  // namespace
+
+// Order book level churn: a queue of resting orders where every new order fills the oldest one.
+template <typename Allocator>
+static void BM_ListOrderChurn(benchmark::State &state) {
+    containers::list<Order, Allocator> orders;
+    long id = 0;
+    for (int i = 0; i < kLevel; ++i) orders.push_back(Order{id++, 100.0, 10});
+    for (auto _ : state) {
+        for (int i = 0; i < kLevel; ++i) {
+            orders.push_back(Order{id++, 100.0, 10});
+            orders.pop_front();
+        }
+        benchmark::DoNotOptimize(orders.front().id);
+    }
+    state.SetItemsProcessed(state.iterations() * kLevel);
+}
+BENCHMARK_TEMPLATE(BM_ListOrderChurn, std::allocator<Order>);
+BENCHMARK_TEMPLATE(BM_ListOrderChurn, containers::pool_allocator<Order>);
+
+// Levels built up and torn down, the pool hands its blocks back on every clear.
+template <typename Allocator>
+static void BM_ListBuildAndClear(benchmark::State &state) {
+    containers::list<Order, Allocator> orders;
+    for (auto _ : state) {
+        for (long i = 0; i < state.range(0); ++i) orders.push_back(Order{i, 100.0, 10});
+        benchmark::DoNotOptimize(orders.back().id);
+        orders.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ListBuildAndClear, std::allocator<Order>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_ListBuildAndClear, containers::pool_allocator<Order>)->Arg(1 << 16);
+
+// LRU cache: a hit moves a random entry to the front, a miss evicts the oldest entry and inserts
+// the new one at the front. Entries are found through iterators kept in an index.
+static void BM_ListLruTouch(benchmark::State &state) {
+    using lru_list = containers::list<long>;
+    lru_list entries;
+    std::vector<lru_list::iterator> index;
+    for (long i = 0; i < state.range(0); ++i) index.push_back(entries.insert(entries.end(), i));
+    std::mt19937 random(42);
+    for (auto _ : state) {
+        entries.splice(entries.begin(), entries, index[random() % index.size()]);
+        long key = entries.back();
+        entries.erase(index[key]);
+        index[key] = entries.insert(entries.begin(), key);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ListLruTouch)->Arg(1 << 10)->Arg(1 << 20);
+
+namespace {
+// Timestamps that are mostly increasing with local jitter, as they arrive from several feeds.
+template <typename List>
+void FillTimestamps(List &timestamps, long count) {
+    std::mt19937_64 random(42);
+    for (long i = 0; i < count; ++i) timestamps.push_back(i * 1000 + random() % 100000);
+}
+}  // namespace
+
+static void BM_ListSort(benchmark::State &state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        containers::list<uint64_t> timestamps;
+        FillTimestamps(timestamps, state.range(0));
+        state.ResumeTiming();
+        timestamps.sort();
+        benchmark::DoNotOptimize(timestamps.front());
+        state.PauseTiming();
+        timestamps.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListSort)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_StdListSort(benchmark::State &state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::list<uint64_t> timestamps;
+        FillTimestamps(timestamps, state.range(0));
+        state.ResumeTiming();
+        timestamps.sort();
+        benchmark::DoNotOptimize(timestamps.front());
+        state.PauseTiming();
+        timestamps.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdListSort)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+// The workaround the in-place sort replaces: copy into a vector, sort it and copy back.
+static void BM_ListSortThroughVector(benchmark::State &state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        containers::list<uint64_t> timestamps;
+        FillTimestamps(timestamps, state.range(0));
+        state.ResumeTiming();
+        std::vector<uint64_t> copy(timestamps.begin(), timestamps.end());
+        std::stable_sort(copy.begin(), copy.end());
+        std::copy(copy.begin(), copy.end(), timestamps.begin());
+        benchmark::DoNotOptimize(timestamps.front());
+        state.PauseTiming();
+        timestamps.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListSortThroughVector)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,135 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../library/mpmc_queue.h"
+#include "../library/queue.h"
+
+namespace {
+constexpr size_t kCapacity = 1024;
+constexpr long kPerProducer = 1 << 15;
+
+// What the dispatcher does today: containers::queue behind a mutex.
+class locked_queue {
+   public:
+    explicit locked_queue(size_t capacity) : capacity_(capacity) {}
+
+    bool try_push(long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.size() == capacity_) return false;
+        queue_.push(value);
+        return true;
+    }
+    bool try_pop(long &value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) return false;
+        value = queue_.front();
+        queue_.pop();
+        return true;
+    }
+
+   private:
+    std::mutex mutex_;
+    containers::queue<long> queue_;
+    size_t capacity_;
+};
+
+// Producer and consumer counts 1, 2, 4, ... up to the number of cores, in every combination.
+void ThreadMatrix(benchmark::internal::Benchmark *benchmark) {
+    int cores = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+    for (int producers = 1; producers <= cores; producers *= 2) {
+        for (int consumers = 1; consumers <= cores; consumers *= 2) {
+            benchmark->Args({producers, consumers});
+        }
+    }
+    benchmark->ArgNames({"producers", "consumers"});
+}
+}  // namespace
+
+// Messages per second through one queue shared by state.range(0) producers and state.range(1)
+// consumers, each producer sends kPerProducer messages per iteration.
+template <typename Queue>
+static void BM_MpmcThroughput(benchmark::State &state) {
+    const long producers = state.range(0);
+    const long consumers = state.range(1);
+    const long total = producers * kPerProducer;
+    for (auto _ : state) {
+        Queue queue(kCapacity);
+        std::atomic<long> remaining{total};
+        std::vector<std::thread> threads;
+        for (long p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue] {
+                for (long i = 0; i < kPerProducer; ++i) {
+                    while (!queue.try_push(i)) std::this_thread::yield();
+                }
+            });
+        }
+        for (long c = 0; c < consumers; ++c) {
+            threads.emplace_back([&queue, &remaining] {
+                long sum = 0;
+                long value;
+                while (remaining.load(std::memory_order_relaxed) > 0) {
+                    if (queue.try_pop(value)) {
+                        sum += value;
+                        remaining.fetch_sub(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                benchmark::DoNotOptimize(sum);
+            });
+        }
+        for (auto &thread : threads) thread.join();
+    }
+    state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_MpmcThroughput, locked_queue)->Apply(ThreadMatrix)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MpmcThroughput, containers::mpmc_queue<long>)
+    ->Apply(ThreadMatrix)
+    ->UseRealTime();
+
+// The same matrix with batches of up to 32 messages on both sides.
+static void BM_MpmcBatchThroughput(benchmark::State &state) {
+    const long producers = state.range(0);
+    const long consumers = state.range(1);
+    const long total = producers * kPerProducer;
+    for (auto _ : state) {
+        containers::mpmc_queue<long> queue(kCapacity);
+        std::atomic<long> remaining{total};
+        std::vector<std::thread> threads;
+        for (long p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue] {
+                long batch[32];
+                for (long i = 0; i < 32; ++i) batch[i] = i;
+                for (long sent = 0; sent < kPerProducer;) {
+                    size_t n = queue.try_push_n(batch, std::min(32L, kPerProducer - sent));
+                    if (n == 0) std::this_thread::yield();
+                    sent += n;
+                }
+            });
+        }
+        for (long c = 0; c < consumers; ++c) {
+            threads.emplace_back([&queue, &remaining] {
+                long batch[32];
+                long sum = 0;
+                while (remaining.load(std::memory_order_relaxed) > 0) {
+                    size_t n = queue.try_pop_n(batch, 32);
+                    if (n == 0) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    for (size_t i = 0; i < n; ++i) sum += batch[i];
+                    remaining.fetch_sub(n, std::memory_order_relaxed);
+                }
+                benchmark::DoNotOptimize(sum);
+            });
+        }
+        for (auto &thread : threads) thread.join();
+    }
+    state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK(BM_MpmcBatchThroughput)->Apply(ThreadMatrix)->UseRealTime();
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <thread>
+
+#include "../library/parallel.h"
+#include "../library/vector.h"
+
+// Scaling over 1, 2, 4, 8 and all hardware threads, the argument is the pool size.
+static void ThreadCounts(benchmark::internal::Benchmark *bench) {
+    for (int threads : {1, 2, 4, 8}) bench->Arg(threads);
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    if (hardware != 1 && hardware != 2 && hardware != 4 && hardware != 8) bench->Arg(hardware);
+    bench->UseRealTime();
+}
+
+static containers::vector<float> Values(size_t n) {
+    containers::vector<float> values(n);
+    for (size_t i = 0; i < n; ++i) values[i] = static_cast<float>(i % 1024) * 0.25f;
+    return values;
+}
+
+constexpr size_t kCount = 1 << 24;
+
+static void BM_ParallelForEach(benchmark::State &state) {
+    containers::parallel::thread_pool pool(state.range(0));
+    containers::vector<float> values = Values(kCount);
+    for (auto _ : state) {
+        containers::parallel::for_each(
+            values, [](float &item) { item = std::sqrt(item) + 1.0f; }, pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(BM_ParallelForEach)->Apply(ThreadCounts);
+
+static void BM_ParallelTransform(benchmark::State &state) {
+    containers::parallel::thread_pool pool(state.range(0));
+    containers::vector<float> input = Values(kCount);
+    containers::vector<float> output(kCount);
+    for (auto _ : state) {
+        containers::parallel::transform(
+            input, output, [](float item) { return item * 2.0f + 1.0f; }, pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kCount * sizeof(float) * 2);
+}
+BENCHMARK(BM_ParallelTransform)->Apply(ThreadCounts);
+
+static void BM_ParallelReduce(benchmark::State &state) {
+    containers::parallel::thread_pool pool(state.range(0));
+    containers::vector<float> values = Values(kCount);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(containers::parallel::reduce(values, 0.0, std::plus<>(), pool));
+    }
+    state.SetBytesProcessed(state.iterations() * kCount * sizeof(float));
+}
+BENCHMARK(BM_ParallelReduce)->Apply(ThreadCounts);
+
+static void BM_ParallelInclusiveScan(benchmark::State &state) {
+    containers::parallel::thread_pool pool(state.range(0));
+    containers::vector<float> input = Values(kCount);
+    containers::vector<float> output(kCount);
+    for (auto _ : state) {
+        containers::parallel::inclusive_scan(input, output, std::plus<>(), pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kCount * sizeof(float) * 2);
+}
+BENCHMARK(BM_ParallelInclusiveScan)->Apply(ThreadCounts);
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../library/priority_queue.h"
+#include "../library/vector.h"
+
+namespace {
+// the earliest deadline on top
+using binary_timers = containers::priority_queue<long, containers::vector<long>, std::greater<long>, 2>;
+using quaternary_timers =
+    containers::priority_queue<long, containers::vector<long>, std::greater<long>, 4>;
+using std_timers = std::priority_queue<long, std::vector<long>, std::greater<long>>;
+
+std::vector<long> Deadlines(long count) {
+    std::mt19937_64 random(42);
+    std::vector<long> deadlines(count);
+    for (auto &deadline : deadlines) deadline = static_cast<long>(random() % 1000000000);
+    return deadlines;
+}
+
+template <typename Queue>
+void Rearm(Queue &timers, long deadline) {
+    timers.pop();
+    timers.push(deadline);
+}
+void Rearm(binary_timers &timers, long deadline) { timers.pop_push(deadline); }
+void Rearm(quaternary_timers &timers, long deadline) { timers.pop_push(deadline); }
+}  // namespace
+
+// A scheduler with `range` armed timers: the earliest one fires and is rearmed further away.
+template <typename Queue>
+static void BM_TimerRearm(benchmark::State &state) {
+    Queue timers;
+    for (long deadline : Deadlines(state.range(0))) timers.push(deadline);
+    std::mt19937_64 random(7);
+    for (auto _ : state) {
+        long now = timers.top();
+        Rearm(timers, now + static_cast<long>(random() % 1000000000));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_TimerRearm, std_timers)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_TimerRearm, binary_timers)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_TimerRearm, quaternary_timers)->Arg(1 << 10)->Arg(1 << 20);
+
+// Draining `range` timers one by one.
+template <typename Queue>
+static void BM_TimerDrain(benchmark::State &state) {
+    std::vector<long> deadlines = Deadlines(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        Queue timers(deadlines.begin(), deadlines.end());
+        state.ResumeTiming();
+        while (!timers.empty()) {
+            benchmark::DoNotOptimize(timers.top());
+            timers.pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TimerDrain, std_timers)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_TimerDrain, binary_timers)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_TimerDrain, quaternary_timers)->Arg(1 << 20);
+
+// Loading `range` timers at once: push one by one against push_range.
+static void BM_TimerLoadPush(benchmark::State &state) {
+    std::vector<long> deadlines = Deadlines(state.range(0));
+    for (auto _ : state) {
+        quaternary_timers timers;
+        for (long deadline : deadlines) timers.push(deadline);
+        benchmark::DoNotOptimize(timers.top());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimerLoadPush)->Arg(1 << 20);
+
+static void BM_TimerLoadPushRange(benchmark::State &state) {
+    std::vector<long> deadlines = Deadlines(state.range(0));
+    for (auto _ : state) {
+        quaternary_timers timers;
+        timers.push_range(deadlines);
+        benchmark::DoNotOptimize(timers.top());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimerLoadPushRange)->Arg(1 << 20);
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include "../library/circular_buffer.h"
+#include "../library/deque.h"
+#include "../library/list.h"
+#include "../library/queue.h"
+
+namespace {
+struct Message {
+    long sequence;
+    long payload[3];
+};
+}  // namespace
+
+// Steady state of a message queue: a backlog of `range` messages, every new message is pushed
+// while the oldest one is consumed.
+template <typename Container>
+static void BM_QueuePushPop(benchmark::State &state) {
+    containers::queue<Message, Container> messages;
+    long sequence = 0;
+    for (long i = 0; i < state.range(0); ++i) messages.push(Message{sequence++, {}});
+    for (auto _ : state) {
+        messages.push(Message{sequence++, {}});
+        benchmark::DoNotOptimize(messages.front().sequence);
+        messages.pop();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_QueuePushPop, containers::list<Message>)->Arg(64)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, containers::circular_buffer<Message>)->Arg(64)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, containers::deque<Message>)->Arg(64)->Arg(1 << 16);
+
+// Bursts: the queue fills up with `range` messages and is drained completely.
+template <typename Container>
+static void BM_QueueBurst(benchmark::State &state) {
+    containers::queue<Message, Container> messages;
+    for (auto _ : state) {
+        for (long i = 0; i < state.range(0); ++i) messages.push(Message{i, {}});
+        while (!messages.empty()) {
+            benchmark::DoNotOptimize(messages.front().sequence);
+            messages.pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_QueueBurst, containers::list<Message>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_QueueBurst, containers::circular_buffer<Message>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_QueueBurst, containers::deque<Message>)->Arg(1 << 12);
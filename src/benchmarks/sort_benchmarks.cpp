@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "../library/parallel.h"
+#include "../library/sort.h"
+#include "../library/vector.h"
+
+namespace {
+template <typename T>
+containers::vector<T> RandomIds(size_t n) {
+    std::mt19937_64 gen(42);
+    containers::vector<T> ids;
+    ids.reserve(n);
+    for (size_t i = 0; i < n; ++i) ids.push_back(static_cast<T>(gen()));
+    return ids;
+}
+
+constexpr size_t kCount = 1 << 22;
+}  // namespace
+
+// The ids are restored from a copy outside the timed region on every iteration.
+template <typename T>
+static void BM_StdSort(benchmark::State &state) {
+    const containers::vector<T> ids = RandomIds<T>(kCount);
+    for (auto _ : state) {
+        state.PauseTiming();
+        containers::vector<T> work(ids);
+        state.ResumeTiming();
+        std::sort(work.data(), work.data() + work.size());
+        benchmark::DoNotOptimize(work.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK_TEMPLATE(BM_StdSort, uint64_t)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StdSort, float)->Unit(benchmark::kMillisecond);
+
+// Radix sort, the argument is the pool size.
+template <typename T>
+static void BM_RadixSort(benchmark::State &state) {
+    containers::parallel::thread_pool pool(state.range(0));
+    const containers::vector<T> ids = RandomIds<T>(kCount);
+    for (auto _ : state) {
+        state.PauseTiming();
+        containers::vector<T> work(ids);
+        state.ResumeTiming();
+        containers::sort(work, std::less<>(), pool);
+        benchmark::DoNotOptimize(work.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+static void ThreadCounts(benchmark::internal::Benchmark *bench) {
+    for (int threads : {1, 2, 4, 8}) bench->Arg(threads);
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    if (hardware != 1 && hardware != 2 && hardware != 4 && hardware != 8) bench->Arg(hardware);
+    bench->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+BENCHMARK_TEMPLATE(BM_RadixSort, uint64_t)->Apply(ThreadCounts);
+BENCHMARK_TEMPLATE(BM_RadixSort, float)->Apply(ThreadCounts);
+
+// Comparator that radix sort cannot use, so pdqsort runs (merge path for several threads).
+static void BM_PdqSort(benchmark::State &state) {
+    containers::parallel::thread_pool pool(state.range(0));
+    const containers::vector<uint64_t> ids = RandomIds<uint64_t>(kCount);
+    auto comp = [](uint64_t a, uint64_t b) { return a < b; };
+    for (auto _ : state) {
+        state.PauseTiming();
+        containers::vector<uint64_t> work(ids);
+        state.ResumeTiming();
+        containers::sort(work, comp, pool);
+        benchmark::DoNotOptimize(work.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(BM_PdqSort)->Apply(ThreadCounts);
+
+static void BM_StableSortStrings(benchmark::State &state) {
+    containers::parallel::thread_pool pool(state.range(0));
+    containers::vector<uint64_t> ids = RandomIds<uint64_t>(kCount / 16);
+    containers::vector<std::string> words;
+    for (size_t i = 0; i < ids.size(); ++i) words.push_back(std::to_string(ids[i] % 100000));
+    for (auto _ : state) {
+        state.PauseTiming();
+        containers::vector<std::string> work(words);
+        state.ResumeTiming();
+        containers::stable_sort(work, std::less<>(), pool);
+        benchmark::DoNotOptimize(work.data());
+    }
+    state.SetItemsProcessed(state.iterations() * words.size());
+}
+BENCHMARK(BM_StableSortStrings)->Apply(ThreadCounts);
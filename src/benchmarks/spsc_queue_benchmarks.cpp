@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "../library/queue.h"
+#include "../library/spsc_queue.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+constexpr size_t kCapacity = 1024;
+constexpr long kBatch = 1 << 16;
+constexpr long kStop = -1;
+
+// Pins the calling thread to one core, so the producer and the consumer do not migrate. Does
+// nothing where affinity is not available or the core does not exist.
+void PinThread(unsigned core) {
+#ifdef __linux__
+    unsigned cores = std::thread::hardware_concurrency();
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cores ? core % cores : 0, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)core;
+#endif
+}
+
+// What the services do today: containers::queue behind a mutex.
+class locked_queue {
+   public:
+    explicit locked_queue(size_t capacity) : capacity_(capacity) {}
+
+    bool try_push(long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.size() == capacity_) return false;
+        queue_.push(value);
+        return true;
+    }
+    bool try_pop(long &value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) return false;
+        value = queue_.front();
+        queue_.pop();
+        return true;
+    }
+
+   private:
+    std::mutex mutex_;
+    containers::queue<long> queue_;
+    size_t capacity_;
+};
+
+template <typename Queue>
+void Push(Queue &queue, long value) {
+    while (!queue.try_push(value)) std::this_thread::yield();
+}
+
+template <typename Queue>
+long Pop(Queue &queue) {
+    long value;
+    while (!queue.try_pop(value)) std::this_thread::yield();
+    return value;
+}
+}  // namespace
+
+// Messages per second from an I/O thread to a worker, the consumer runs on its own core.
+template <typename Queue>
+static void BM_SpscThroughput(benchmark::State &state) {
+    PinThread(0);
+    Queue queue(kCapacity);
+    std::atomic<long> consumed{0};
+    std::thread consumer([&] {
+        PinThread(1);
+        long sum = 0;
+        for (long value; (value = Pop(queue)) != kStop;) {
+            sum += value;
+            consumed.store(consumed.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+    long sent = 0;
+    for (auto _ : state) {
+        for (long i = 0; i < kBatch; ++i) Push(queue, i);
+        sent += kBatch;
+        while (consumed.load(std::memory_order_acquire) != sent) std::this_thread::yield();
+    }
+    Push(queue, kStop);
+    consumer.join();
+    state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK_TEMPLATE(BM_SpscThroughput, locked_queue)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpscThroughput, containers::spsc_queue<long>)->UseRealTime();
+
+// The same with batched pushes and pops of up to 64 messages.
+static void BM_SpscBatchThroughput(benchmark::State &state) {
+    PinThread(0);
+    containers::spsc_queue<long> queue(kCapacity);
+    std::atomic<long> consumed{0};
+    std::atomic<bool> done{false};
+    std::thread consumer([&] {
+        PinThread(1);
+        long batch[64];
+        long sum = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            size_t n = queue.try_pop_n(batch, 64);
+            if (n == 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (size_t i = 0; i < n; ++i) sum += batch[i];
+            consumed.store(consumed.load(std::memory_order_relaxed) + n, std::memory_order_release);
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+    long batch[64];
+    for (long i = 0; i < 64; ++i) batch[i] = i;
+    long sent = 0;
+    for (auto _ : state) {
+        for (long pushed = 0; pushed < kBatch;) {
+            size_t n = queue.try_push_n(batch, kBatch - pushed < 64 ? kBatch - pushed : 64);
+            if (n == 0) std::this_thread::yield();
+            pushed += n;
+        }
+        sent += kBatch;
+        while (consumed.load(std::memory_order_acquire) != sent) std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+    consumer.join();
+    state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK(BM_SpscBatchThroughput)->UseRealTime();
+
+// Round trip of one message to a thread that echoes it back, the time is per round trip.
+template <typename Queue>
+static void BM_SpscPingPong(benchmark::State &state) {
+    PinThread(0);
+    Queue requests(kCapacity);
+    Queue replies(kCapacity);
+    std::thread echo([&] {
+        PinThread(1);
+        for (long value; (value = Pop(requests)) != kStop;) Push(replies, value);
+    });
+    long i = 0;
+    for (auto _ : state) {
+        Push(requests, i);
+        benchmark::DoNotOptimize(Pop(replies));
+        ++i;
+    }
+    Push(requests, kStop);
+    echo.join();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_SpscPingPong, locked_queue)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpscPingPong, containers::spsc_queue<long>)->UseRealTime();
@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "../library/deque.h"
+#include "../library/stack.h"
+#include "../library/vector.h"
+
+// Building a stack of `range` strings from scratch and unwinding it: vector reallocates and moves
+// every element on growth, deque only adds blocks.
+template <typename Container>
+static void BM_StackGrowAndUnwind(benchmark::State &state) {
+    for (auto _ : state) {
+        containers::stack<std::string, Container> frames;
+        for (long i = 0; i < state.range(0); ++i) frames.emplace(32, 'x');
+        while (!frames.empty()) {
+            benchmark::DoNotOptimize(frames.top().data());
+            frames.pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StackGrowAndUnwind, containers::vector<std::string>)
+    ->Arg(1 << 10)
+    ->Arg(1 << 18);
+BENCHMARK_TEMPLATE(BM_StackGrowAndUnwind, containers::deque<std::string>)
+    ->Arg(1 << 10)
+    ->Arg(1 << 18);
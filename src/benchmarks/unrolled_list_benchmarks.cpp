@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../library/list.h"
+#include "../library/unrolled_list.h"
+#include "../library/vector.h"
+
+// Sums a sequence built by pushes at the back, the nodes of both lists are scattered over the heap
+// by interleaved allocations the way they are in a long running process.
+template <typename Sequence>
+static void BM_Traverse(benchmark::State &state) {
+    Sequence values;
+    std::vector<std::vector<char>> noise;
+    for (long i = 0; i < state.range(0); ++i) {
+        values.push_back(i);
+        if (i % 4 == 0) noise.emplace_back(48);
+    }
+    noise.clear();
+    for (auto _ : state) {
+        long sum = std::accumulate(values.begin(), values.end(), 0L);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Traverse, containers::list<long>)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Traverse, containers::unrolled_list<long>)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Traverse, containers::vector<long>)->Arg(1 << 20);
+
+// Inserts at random positions that are found by walking from the front, as an ordered sequence
+// without an index has to.
+template <typename Sequence>
+static void BM_InsertMiddle(benchmark::State &state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        Sequence values;
+        for (long i = 0; i < state.range(0); ++i) values.push_back(i);
+        std::mt19937 random(42);
+        state.ResumeTiming();
+        for (long i = 0; i < 1024; ++i) {
+            auto pos = std::next(values.begin(), random() % values.size());
+            values.insert(pos, i);
+        }
+        benchmark::DoNotOptimize(values.size());
+        state.PauseTiming();
+        values.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK_TEMPLATE(BM_InsertMiddle, containers::list<long>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_InsertMiddle, containers::unrolled_list<long>)->Arg(1 << 16);
@@ -0,0 +1,248 @@
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../library/mmap_allocator.h"
+#include "../library/vector.h"
+
+namespace {
+struct Record {
+    static inline long copies = 0;
+    std::string name;
+    std::vector<int> payload;
+
+    Record(const std::string &n, size_t size) : name(n), payload(size) {}
+    Record(const Record &other) : name(other.name), payload(other.payload) { ++copies; }
+    Record(Record &&other) noexcept = default;
+    Record &operator=(const Record &other) {
+        name = other.name;
+        payload = other.payload;
+        ++copies;
+        return *this;
+    }
+    Record &operator=(Record &&other) noexcept = default;
+};
+
+const std::string kName = "a record name long enough to live on the heap";
+constexpr size_t kPayload = 16;
+constexpr int kBatch = 1024;
+
+// Resident set size of the process, 0 where /proc is not available.
+double ResidentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    long size = 0, resident = 0;
+    statm >> size >> resident;
+    return static_cast<double>(resident) * sysconf(_SC_PAGESIZE);
+}
+
+void ReportCopies(benchmark::State &state, long copies) {
+    state.counters["copies/op"] =
+        benchmark::Counter(static_cast<double>(copies) / kBatch, benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * kBatch);
+}
+}  // namespace
+
+static void BM_VectorPushBackCopy(benchmark::State &state) {
+    Record::copies = 0;
+    for (auto _ : state) {
+        containers::vector<Record> vec;
+        for (int i = 0; i < kBatch; ++i) {
+            Record record(kName, kPayload);
+            vec.push_back(record);
+        }
+        benchmark::DoNotOptimize(vec.size());
+    }
+    ReportCopies(state, Record::copies);
+}
+BENCHMARK(BM_VectorPushBackCopy);
+
+static void BM_VectorPushBackMove(benchmark::State &state) {
+    Record::copies = 0;
+    for (auto _ : state) {
+        containers::vector<Record> vec;
+        for (int i = 0; i < kBatch; ++i) {
+            vec.push_back(Record(kName, kPayload));
+        }
+        benchmark::DoNotOptimize(vec.size());
+    }
+    ReportCopies(state, Record::copies);
+}
+BENCHMARK(BM_VectorPushBackMove);
+
+static void BM_VectorEmplaceBack(benchmark::State &state) {
+    Record::copies = 0;
+    for (auto _ : state) {
+        containers::vector<Record> vec;
+        for (int i = 0; i < kBatch; ++i) {
+            vec.emplace_back(kName, kPayload);
+        }
+        benchmark::DoNotOptimize(vec.size());
+    }
+    ReportCopies(state, Record::copies);
+}
+BENCHMARK(BM_VectorEmplaceBack);
+
+static void BM_StdVectorEmplaceBack(benchmark::State &state) {
+    Record::copies = 0;
+    for (auto _ : state) {
+        std::vector<Record> vec;
+        for (int i = 0; i < kBatch; ++i) {
+            vec.emplace_back(kName, kPayload);
+        }
+        benchmark::DoNotOptimize(vec.size());
+    }
+    ReportCopies(state, Record::copies);
+}
+BENCHMARK(BM_StdVectorEmplaceBack);
+
+static void BM_VectorInsertManyFront(benchmark::State &state) {
+    Record::copies = 0;
+    for (auto _ : state) {
+        containers::vector<Record> vec;
+        for (int i = 0; i < kBatch / 4; ++i) {
+            vec.insert_many_front(Record(kName, kPayload), Record(kName, kPayload), Record(kName, kPayload),
+                                  Record(kName, kPayload));
+        }
+        benchmark::DoNotOptimize(vec.size());
+    }
+    ReportCopies(state, Record::copies);
+}
+BENCHMARK(BM_VectorInsertManyFront);
+
+static void BM_VectorInsertManyBack(benchmark::State &state) {
+    Record::copies = 0;
+    for (auto _ : state) {
+        containers::vector<Record> vec;
+        for (int i = 0; i < kBatch / 4; ++i) {
+            vec.insert_many_back(Record(kName, kPayload), Record(kName, kPayload), Record(kName, kPayload),
+                                 Record(kName, kPayload));
+        }
+        benchmark::DoNotOptimize(vec.size());
+    }
+    ReportCopies(state, Record::copies);
+}
+BENCHMARK(BM_VectorInsertManyBack);
+
+static void BM_VectorPushBackBatch(benchmark::State &state) {
+    std::vector<int> batch(state.range(0), 7);
+    for (auto _ : state) {
+        containers::vector<int> vec;
+        for (int value : batch) vec.push_back(value);
+        benchmark::DoNotOptimize(vec.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorPushBackBatch)->Arg(10000)->Arg(100000);
+
+static void BM_VectorAppendRange(benchmark::State &state) {
+    std::vector<int> batch(state.range(0), 7);
+    for (auto _ : state) {
+        containers::vector<int> vec;
+        vec.append_range(batch);
+        benchmark::DoNotOptimize(vec.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorAppendRange)->Arg(10000)->Arg(100000);
+
+template <typename Policy>
+static void BM_VectorGrowthPolicy(benchmark::State &state) {
+    const size_t count = state.range(0);
+    double reserved = 0, resident = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        double before = ResidentBytes();
+        state.ResumeTiming();
+
+        containers::vector<int, std::allocator<int>, Policy> vec;
+        for (size_t i = 0; i < count; ++i) vec.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(vec.size());
+
+        state.PauseTiming();
+        resident = ResidentBytes() - before;
+        reserved = static_cast<double>(vec.capacity() * sizeof(int));
+        state.ResumeTiming();
+    }
+    state.counters["reserved_MiB"] = reserved / (1 << 20);
+    state.counters["rss_MiB"] = resident / (1 << 20);
+    state.counters["slack_pct"] = 100.0 * (reserved - count * sizeof(int)) / reserved;
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, containers::doubling_growth)->Arg(3 << 20)->Arg(32 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, containers::one_and_half_growth)->Arg(3 << 20)->Arg(32 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, containers::page_rounded_growth<>)->Arg(3 << 20)->Arg(32 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, containers::size_class_growth<containers::one_and_half_growth>)
+    ->Arg(3 << 20)
+    ->Arg(32 << 20);
+
+template <typename Allocator>
+static void BM_VectorHugeGrowth(benchmark::State &state) {
+    const size_t count = state.range(0);
+    for (auto _ : state) {
+        containers::vector<int, Allocator> vec;
+        for (size_t i = 0; i < count; ++i) vec.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(vec.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_VectorHugeGrowth, std::allocator<int>)->Arg(64 << 20);
+BENCHMARK_TEMPLATE(BM_VectorHugeGrowth, containers::mmap_allocator<int>)->Arg(64 << 20);
+BENCHMARK_TEMPLATE(BM_VectorHugeGrowth, containers::mmap_allocator<int, true>)->Arg(64 << 20);
+
+template <typename Allocator>
+static void BM_VectorHugeScan(benchmark::State &state) {
+    containers::vector<int, Allocator> vec;
+    vec.reserve(state.range(0));
+    for (int64_t i = 0; i < state.range(0); ++i) vec.push_back(static_cast<int>(i));
+    for (auto _ : state) {
+        long long sum = 0;
+        for (size_t i = 0; i < vec.size(); i += 16) sum += vec[i];  // one touch per cache line
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * vec.size() / 16);
+}
+BENCHMARK_TEMPLATE(BM_VectorHugeScan, std::allocator<int>)->Arg(64 << 20);
+BENCHMARK_TEMPLATE(BM_VectorHugeScan, containers::mmap_allocator<int, true>)->Arg(64 << 20);
+
+// Sum loops over the three accessors. The bound is not size(), so at() has to keep its throwing
+// check inside the loop, which blocks vectorization. operator[] is unchecked in this NDEBUG build
+// and should match data().
+static void BM_VectorSumAt(benchmark::State &state) {
+    const size_t count = state.range(0);
+    containers::vector<int> vec(count);
+    for (auto _ : state) {
+        int sum = 0;
+        for (size_t i = 0; i < count; ++i) sum += vec.at(i);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorSumAt)->Arg(1 << 16);
+
+static void BM_VectorSumSubscript(benchmark::State &state) {
+    const size_t count = state.range(0);
+    containers::vector<int> vec(count);
+    for (auto _ : state) {
+        int sum = 0;
+        for (size_t i = 0; i < count; ++i) sum += vec[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorSumSubscript)->Arg(1 << 16);
+
+static void BM_VectorSumData(benchmark::State &state) {
+    const size_t count = state.range(0);
+    containers::vector<int> vec(count);
+    for (auto _ : state) {
+        const int *data = vec.data();
+        int sum = 0;
+        for (size_t i = 0; i < count; ++i) sum += data[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorSumData)->Arg(1 << 16);
@@ -1,10 +1,25 @@
 #ifndef S21_CONTAINERS_H
 #define S21_CONTAINERS_H
 
+#include "library/algorithm.h"
+#include "library/circular_buffer.h"
+#include "library/concurrent_queue.h"
+#include "library/concurrent_stack.h"
+#include "library/deque.h"
+#include "library/fork_join.h"
+#include "library/intrusive_list.h"
 #include "library/list.h"
+#include "library/mpmc_queue.h"
+#include "library/parallel.h"
+#include "library/priority_queue.h"
 #include "library/queue.h"
+#include "library/small_vector.h"
+#include "library/sort.h"
+#include "library/spsc_queue.h"
 #include "library/stack.h"
+#include "library/unrolled_list.h"
 #include "library/vector.h"
+#include "library/work_stealing_deque.h"
 #include "library/array.h"
 
 #endif  // S21_CONTAINERS_H
\ No newline at end of file
@@ -0,0 +1,493 @@
+#ifndef CONTAINERS_ALGORITHM
+#define CONTAINERS_ALGORITHM
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CONTAINERS_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// Search, compare and fill algorithms for contiguous containers (array, vector, small_vector).
+// Ranges of int8_t, uint8_t, char, int32_t, uint32_t and float are processed with SSE2, AVX2 or
+// AVX-512 kernels chosen at runtime for the running CPU; other element types use scalar loops.
+// min_element and max_element assume that float ranges hold no NaN.
+namespace containers {
+namespace detail {
+enum class simd_level { scalar, sse2, avx2, avx512 };
+
+// The best instruction set the CPU supports, detected once. Every level also needs popcnt.
+inline simd_level cpu_simd_level() noexcept {
+#ifdef CONTAINERS_SIMD_X86
+    static const simd_level level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+            __builtin_cpu_supports("popcnt")) {
+            return simd_level::avx512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+            return simd_level::avx2;
+        }
+        if (__builtin_cpu_supports("sse2") && __builtin_cpu_supports("popcnt")) {
+            return simd_level::sse2;
+        }
+        return simd_level::scalar;
+    }();
+    return level;
+#else
+    return simd_level::scalar;
+#endif
+}
+
+// The lane type the kernels use for T, void when T has no kernels.
+template <typename T>
+struct simd_lane {
+    using type = void;
+};
+template <>
+struct simd_lane<int8_t> {
+    using type = int8_t;
+};
+template <>
+struct simd_lane<uint8_t> {
+    using type = uint8_t;
+};
+template <>
+struct simd_lane<char> {
+    using type = std::conditional_t<std::is_signed_v<char>, int8_t, uint8_t>;
+};
+template <>
+struct simd_lane<int32_t> {
+    using type = int32_t;
+};
+template <>
+struct simd_lane<uint32_t> {
+    using type = uint32_t;
+};
+template <>
+struct simd_lane<float> {
+    using type = float;
+};
+
+template <typename T>
+using simd_lane_t = typename simd_lane<std::remove_cv_t<T>>::type;
+
+namespace scalar {
+template <typename T>
+size_t find(const T *first, size_t n, const T &value) {
+    for (size_t i = 0; i < n; ++i) {
+        if (first[i] == value) return i;
+    }
+    return n;
+}
+
+template <typename T>
+size_t count(const T *first, size_t n, const T &value) {
+    size_t result = 0;
+    for (size_t i = 0; i < n; ++i) result += first[i] == value;
+    return result;
+}
+
+template <typename T>
+bool equal(const T *first1, const T *first2, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (!(first1[i] == first2[i])) return false;
+    }
+    return true;
+}
+
+template <typename T>
+void fill(T *first, size_t n, const T &value) {
+    for (size_t i = 0; i < n; ++i) first[i] = value;
+}
+
+template <bool Max, typename T>
+size_t extreme_index(const T *first, size_t n) {
+    if (n == 0) return 0;
+    size_t best = 0;
+    for (size_t i = 1; i < n; ++i) {
+        if (Max ? first[best] < first[i] : first[i] < first[best]) best = i;
+    }
+    return best;
+}
+}  // namespace scalar
+
+#ifdef CONTAINERS_SIMD_X86
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse2,popcnt"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("sse2,popcnt")
+#endif
+namespace sse2 {
+template <typename T>
+struct ops;
+
+inline size_t bit_count(uint64_t mask) { return __builtin_popcountll(mask); }
+
+// SSE2 lacks signed byte and 32-bit min/max, they are built from compares. Flipping the sign bit
+// maps unsigned order onto signed order and back.
+struct ops_base {
+    using vec = __m128i;
+    static vec load(const void *p) { return _mm_loadu_si128(static_cast<const __m128i *>(p)); }
+    static void store(void *p, vec v) { _mm_storeu_si128(static_cast<__m128i *>(p), v); }
+    static vec select(vec mask, vec a, vec b) {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    static uint64_t eq8(vec a, vec b) {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+    }
+    static uint64_t eq32(vec a, vec b) {
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+    }
+};
+
+template <>
+struct ops<uint8_t> : ops_base {
+    static constexpr size_t width = 16;
+    static vec set1(uint8_t v) { return _mm_set1_epi8(static_cast<char>(v)); }
+    static vec min(vec a, vec b) { return _mm_min_epu8(a, b); }
+    static vec max(vec a, vec b) { return _mm_max_epu8(a, b); }
+    static uint64_t eq(vec a, vec b) { return eq8(a, b); }
+};
+
+template <>
+struct ops<int8_t> : ops_base {
+    static constexpr size_t width = 16;
+    static vec flip(vec v) { return _mm_xor_si128(v, _mm_set1_epi8(static_cast<char>(0x80))); }
+    static vec set1(int8_t v) { return _mm_set1_epi8(v); }
+    static vec min(vec a, vec b) { return flip(_mm_min_epu8(flip(a), flip(b))); }
+    static vec max(vec a, vec b) { return flip(_mm_max_epu8(flip(a), flip(b))); }
+    static uint64_t eq(vec a, vec b) { return eq8(a, b); }
+};
+
+template <>
+struct ops<int32_t> : ops_base {
+    static constexpr size_t width = 4;
+    static vec set1(int32_t v) { return _mm_set1_epi32(v); }
+    static vec min(vec a, vec b) { return select(_mm_cmplt_epi32(a, b), a, b); }
+    static vec max(vec a, vec b) { return select(_mm_cmpgt_epi32(a, b), a, b); }
+    static uint64_t eq(vec a, vec b) { return eq32(a, b); }
+};
+
+template <>
+struct ops<uint32_t> : ops_base {
+    static constexpr size_t width = 4;
+    static vec flip(vec v) { return _mm_xor_si128(v, _mm_set1_epi32(INT32_MIN)); }
+    static vec set1(uint32_t v) { return _mm_set1_epi32(static_cast<int32_t>(v)); }
+    static vec min(vec a, vec b) { return select(_mm_cmplt_epi32(flip(a), flip(b)), a, b); }
+    static vec max(vec a, vec b) { return select(_mm_cmpgt_epi32(flip(a), flip(b)), a, b); }
+    static uint64_t eq(vec a, vec b) { return eq32(a, b); }
+};
+
+template <>
+struct ops<float> {
+    using vec = __m128;
+    static constexpr size_t width = 4;
+    static vec load(const float *p) { return _mm_loadu_ps(p); }
+    static void store(float *p, vec v) { _mm_storeu_ps(p, v); }
+    static vec set1(float v) { return _mm_set1_ps(v); }
+    static vec min(vec a, vec b) { return _mm_min_ps(a, b); }
+    static vec max(vec a, vec b) { return _mm_max_ps(a, b); }
+    static uint64_t eq(vec a, vec b) {
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpeq_ps(a, b)));
+    }
+};
+
+#include "simd_kernels.h"
+}  // namespace sse2
+#if defined(__clang__)
+#pragma clang attribute pop
+#pragma clang attribute push(__attribute__((target("avx2,popcnt"))), apply_to = function)
+#else
+#pragma GCC pop_options
+#pragma GCC push_options
+#pragma GCC target("avx2,popcnt")
+#endif
+namespace avx2 {
+template <typename T>
+struct ops;
+
+inline size_t bit_count(uint64_t mask) { return __builtin_popcountll(mask); }
+
+struct ops_base {
+    using vec = __m256i;
+    static vec load(const void *p) { return _mm256_loadu_si256(static_cast<const __m256i *>(p)); }
+    static void store(void *p, vec v) { _mm256_storeu_si256(static_cast<__m256i *>(p), v); }
+    static uint64_t eq8(vec a, vec b) {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+    }
+    static uint64_t eq32(vec a, vec b) {
+        __m256i equal = _mm256_cmpeq_epi32(a, b);
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+    }
+};
+
+template <>
+struct ops<uint8_t> : ops_base {
+    static constexpr size_t width = 32;
+    static vec set1(uint8_t v) { return _mm256_set1_epi8(static_cast<char>(v)); }
+    static vec min(vec a, vec b) { return _mm256_min_epu8(a, b); }
+    static vec max(vec a, vec b) { return _mm256_max_epu8(a, b); }
+    static uint64_t eq(vec a, vec b) { return eq8(a, b); }
+};
+
+template <>
+struct ops<int8_t> : ops_base {
+    static constexpr size_t width = 32;
+    static vec set1(int8_t v) { return _mm256_set1_epi8(v); }
+    static vec min(vec a, vec b) { return _mm256_min_epi8(a, b); }
+    static vec max(vec a, vec b) { return _mm256_max_epi8(a, b); }
+    static uint64_t eq(vec a, vec b) { return eq8(a, b); }
+};
+
+template <>
+struct ops<int32_t> : ops_base {
+    static constexpr size_t width = 8;
+    static vec set1(int32_t v) { return _mm256_set1_epi32(v); }
+    static vec min(vec a, vec b) { return _mm256_min_epi32(a, b); }
+    static vec max(vec a, vec b) { return _mm256_max_epi32(a, b); }
+    static uint64_t eq(vec a, vec b) { return eq32(a, b); }
+};
+
+template <>
+struct ops<uint32_t> : ops_base {
+    static constexpr size_t width = 8;
+    static vec set1(uint32_t v) { return _mm256_set1_epi32(static_cast<int32_t>(v)); }
+    static vec min(vec a, vec b) { return _mm256_min_epu32(a, b); }
+    static vec max(vec a, vec b) { return _mm256_max_epu32(a, b); }
+    static uint64_t eq(vec a, vec b) { return eq32(a, b); }
+};
+
+template <>
+struct ops<float> {
+    using vec = __m256;
+    static constexpr size_t width = 8;
+    static vec load(const float *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, vec v) { _mm256_storeu_ps(p, v); }
+    static vec set1(float v) { return _mm256_set1_ps(v); }
+    static vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+    static vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+    static uint64_t eq(vec a, vec b) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+};
+
+#include "simd_kernels.h"
+}  // namespace avx2
+#if defined(__clang__)
+#pragma clang attribute pop
+#pragma clang attribute push(__attribute__((target("avx512f,avx512bw,popcnt"))), \
+                             apply_to = function)
+#else
+#pragma GCC pop_options
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,popcnt")
+// GCC 12 reports the self-initialized placeholder of _mm512_undefined_* in the min/max intrinsics
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+namespace avx512 {
+template <typename T>
+struct ops;
+
+inline size_t bit_count(uint64_t mask) { return __builtin_popcountll(mask); }
+
+struct ops_base {
+    using vec = __m512i;
+    static vec load(const void *p) { return _mm512_loadu_si512(p); }
+    static void store(void *p, vec v) { _mm512_storeu_si512(p, v); }
+};
+
+template <>
+struct ops<uint8_t> : ops_base {
+    static constexpr size_t width = 64;
+    static vec set1(uint8_t v) { return _mm512_set1_epi8(static_cast<char>(v)); }
+    static vec min(vec a, vec b) { return _mm512_min_epu8(a, b); }
+    static vec max(vec a, vec b) { return _mm512_max_epu8(a, b); }
+    static uint64_t eq(vec a, vec b) { return _mm512_cmpeq_epi8_mask(a, b); }
+};
+
+template <>
+struct ops<int8_t> : ops_base {
+    static constexpr size_t width = 64;
+    static vec set1(int8_t v) { return _mm512_set1_epi8(v); }
+    static vec min(vec a, vec b) { return _mm512_min_epi8(a, b); }
+    static vec max(vec a, vec b) { return _mm512_max_epi8(a, b); }
+    static uint64_t eq(vec a, vec b) { return _mm512_cmpeq_epi8_mask(a, b); }
+};
+
+template <>
+struct ops<int32_t> : ops_base {
+    static constexpr size_t width = 16;
+    static vec set1(int32_t v) { return _mm512_set1_epi32(v); }
+    static vec min(vec a, vec b) { return _mm512_min_epi32(a, b); }
+    static vec max(vec a, vec b) { return _mm512_max_epi32(a, b); }
+    static uint64_t eq(vec a, vec b) { return _mm512_cmpeq_epi32_mask(a, b); }
+};
+
+template <>
+struct ops<uint32_t> : ops_base {
+    static constexpr size_t width = 16;
+    static vec set1(uint32_t v) { return _mm512_set1_epi32(static_cast<int32_t>(v)); }
+    static vec min(vec a, vec b) { return _mm512_min_epu32(a, b); }
+    static vec max(vec a, vec b) { return _mm512_max_epu32(a, b); }
+    static uint64_t eq(vec a, vec b) { return _mm512_cmpeq_epi32_mask(a, b); }
+};
+
+template <>
+struct ops<float> {
+    using vec = __m512;
+    static constexpr size_t width = 16;
+    static vec load(const float *p) { return _mm512_loadu_ps(p); }
+    static void store(float *p, vec v) { _mm512_storeu_ps(p, v); }
+    static vec set1(float v) { return _mm512_set1_ps(v); }
+    static vec min(vec a, vec b) { return _mm512_min_ps(a, b); }
+    static vec max(vec a, vec b) { return _mm512_max_ps(a, b); }
+    static uint64_t eq(vec a, vec b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+};
+
+#include "simd_kernels.h"
+}  // namespace avx512
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+#endif  // CONTAINERS_SIMD_X86
+
+// Runs `kernel` with the lane type of T and the instruction set namespace for `level`, returns
+// false when T has no kernels or the level is scalar.
+#ifdef CONTAINERS_SIMD_X86
+#define CONTAINERS_SIMD_DISPATCH(level, call)          \
+    switch (level) {                                   \
+        case simd_level::avx512:                       \
+            return avx512::call;                       \
+        case simd_level::avx2:                         \
+            return avx2::call;                         \
+        case simd_level::sse2:                         \
+            return sse2::call;                         \
+        case simd_level::scalar:                       \
+            break;                                     \
+    }
+#else
+#define CONTAINERS_SIMD_DISPATCH(level, call) (void)(level);
+#endif
+
+template <typename T>
+size_t find(simd_level level, const T *first, size_t n, const T &value) {
+    using lane = simd_lane_t<T>;
+    if constexpr (!std::is_void_v<lane>) {
+        const lane *p = reinterpret_cast<const lane *>(first);
+        lane v;
+        std::memcpy(&v, &value, sizeof(lane));
+        CONTAINERS_SIMD_DISPATCH(level, find(p, n, v))
+    }
+    return scalar::find(first, n, value);
+}
+
+template <typename T>
+size_t count(simd_level level, const T *first, size_t n, const T &value) {
+    using lane = simd_lane_t<T>;
+    if constexpr (!std::is_void_v<lane>) {
+        const lane *p = reinterpret_cast<const lane *>(first);
+        lane v;
+        std::memcpy(&v, &value, sizeof(lane));
+        CONTAINERS_SIMD_DISPATCH(level, count(p, n, v))
+    }
+    return scalar::count(first, n, value);
+}
+
+template <typename T>
+bool equal(simd_level level, const T *first1, const T *first2, size_t n) {
+    using lane = simd_lane_t<T>;
+    if constexpr (!std::is_void_v<lane>) {
+        const lane *p1 = reinterpret_cast<const lane *>(first1);
+        const lane *p2 = reinterpret_cast<const lane *>(first2);
+        CONTAINERS_SIMD_DISPATCH(level, equal(p1, p2, n))
+    }
+    return scalar::equal(first1, first2, n);
+}
+
+template <typename T>
+void fill(simd_level level, T *first, size_t n, const T &value) {
+    using lane = simd_lane_t<T>;
+    if constexpr (!std::is_void_v<lane>) {
+        lane *p = reinterpret_cast<lane *>(first);
+        lane v;
+        std::memcpy(&v, &value, sizeof(lane));
+        if (sizeof(lane) == 1 && level != simd_level::scalar) {
+            std::memset(p, v, n);  // the C library already has the best byte fill
+            return;
+        }
+        CONTAINERS_SIMD_DISPATCH(level, fill(p, n, v))
+    }
+    scalar::fill(first, n, value);
+}
+
+template <bool Max, typename T>
+size_t extreme_index(simd_level level, const T *first, size_t n) {
+    using lane = simd_lane_t<T>;
+    if constexpr (!std::is_void_v<lane>) {
+        const lane *p = reinterpret_cast<const lane *>(first);
+        CONTAINERS_SIMD_DISPATCH(level, extreme_index<Max>(p, n))
+    }
+    return scalar::extreme_index<Max>(first, n);
+}
+
+#undef CONTAINERS_SIMD_DISPATCH
+
+template <typename Container>
+using element_t =
+    std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<Container &>().data())>>;
+}  // namespace detail
+
+// Iterator to the first element equal to value, end() if there is none.
+template <typename Container>
+auto find(const Container &container, const detail::element_t<Container> &value) {
+    size_t index =
+        detail::find(detail::cpu_simd_level(), container.data(), container.size(), value);
+    return container.begin() + index;
+}
+
+template <typename Container>
+size_t count(const Container &container, const detail::element_t<Container> &value) {
+    return detail::count(detail::cpu_simd_level(), container.data(), container.size(), value);
+}
+
+// Iterator to the first smallest element, end() for an empty container.
+template <typename Container>
+auto min_element(const Container &container) {
+    size_t index =
+        detail::extreme_index<false>(detail::cpu_simd_level(), container.data(), container.size());
+    return container.begin() + index;
+}
+
+// Iterator to the first largest element, end() for an empty container.
+template <typename Container>
+auto max_element(const Container &container) {
+    size_t index =
+        detail::extreme_index<true>(detail::cpu_simd_level(), container.data(), container.size());
+    return container.begin() + index;
+}
+
+// True when both containers have the same size and equal elements.
+template <typename Container1, typename Container2>
+bool equal(const Container1 &left, const Container2 &right) {
+    static_assert(std::is_same_v<detail::element_t<Container1>, detail::element_t<Container2>>,
+                  "containers must have the same element type");
+    return left.size() == right.size() &&
+           detail::equal(detail::cpu_simd_level(), left.data(), right.data(), left.size());
+}
+
+template <typename Container>
+void fill(Container &container, const detail::element_t<Container> &value) {
+    detail::fill(detail::cpu_simd_level(), container.data(), container.size(), value);
+}
+}  // namespace containers
+
+#endif
@@ -3,8 +3,13 @@
 
 #include <stddef.h>
 
+#include <cstring>
 #include <iostream>
 
+#include "algorithm.h"
+#include "bounds_check.h"
+#include "iterator.h"
+
 namespace containers {
 template <typename T, size_t _size>
 class array {
@@ -18,31 +23,8 @@ class array {
     std::allocator<T> allocator_;
 
    public:
-    // Iterator
-    class iterator {
-       private:
-        T* ptr_;
-
-       public:
-        iterator(T* ptr) : ptr_(ptr) {}
-        reference operator*() const { return *ptr_; }
-        iterator& operator++() {
-            ++ptr_;
-            return *this;
-        }
-        iterator& operator--() {
-            --ptr_;
-            return *this;
-        }
-        iterator operator+(std::ptrdiff_t n) { return iterator(ptr_ + n); }
-        iterator operator-(std::ptrdiff_t n) { return iterator(ptr_ - n); }
-        bool operator>(const iterator& other) const { return ptr_ > other.ptr_; }
-        bool operator>=(const iterator& other) const { return ptr_ >= other.ptr_; }
-        bool operator<(const iterator& other) const { return ptr_ < other.ptr_; }
-        bool operator==(const iterator& other) const { return ptr_ == other.ptr_; }
-        bool operator!=(const iterator& other) const { return ptr_ != other.ptr_; }
-        T* get_ptr() { return ptr_; }
-    };
+    using iterator = contiguous_iterator<T>;
+    using const_iterator = contiguous_iterator<const T>;
 
     // Array Member functions
     array();
@@ -56,13 +38,21 @@ class array {
 
     // Array Element access
     reference at(size_type pos);
-    reference operator[](size_type pos);
+    const_reference at(size_type pos) const;
+    reference operator[](size_type pos) noexcept;
+    const_reference operator[](size_type pos) const noexcept;
     const_reference front() const;
     const_reference back() const;
+    T* data() noexcept;
+    const T* data() const noexcept;
 
     // Array Iterators
-    iterator begin() const;
-    iterator end() const;
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
 
     // Array Capacity
     bool empty() const noexcept;
@@ -144,13 +134,27 @@ containers::array<T, _size>& containers::array<T, _size>::operator=(array&& righ
 
 template <typename T, size_t _size>
 typename containers::array<T, _size>::reference containers::array<T, _size>::at(size_type pos) {
-    if (pos >= size_ || pos < 0) throw std::out_of_range("out_of_range");
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return data_[pos];
+}
+
+template <typename T, size_t _size>
+typename containers::array<T, _size>::const_reference containers::array<T, _size>::at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
     return data_[pos];
 }
 
 template <typename T, size_t _size>
-typename containers::array<T, _size>::reference containers::array<T, _size>::operator[](size_type pos) {
-    return at(pos);
+typename containers::array<T, _size>::reference containers::array<T, _size>::operator[](size_type pos) noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return data_[pos];
+}
+
+template <typename T, size_t _size>
+typename containers::array<T, _size>::const_reference containers::array<T, _size>::operator[](
+    size_type pos) const noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return data_[pos];
 }
 
 template <typename T, size_t _size>
@@ -164,12 +168,48 @@ typename containers::array<T, _size>::const_reference containers::array<T, _size
 }
 
 template <typename T, size_t _size>
-typename containers::array<T, _size>::iterator containers::array<T, _size>::begin() const {
+T* containers::array<T, _size>::data() noexcept {
     return data_;
 }
 
 template <typename T, size_t _size>
-typename containers::array<T, _size>::iterator containers::array<T, _size>::end() const {
+const T* containers::array<T, _size>::data() const noexcept {
+    return data_;
+}
+
+template <typename T, size_t _size>
+typename containers::array<T, _size>::iterator
+containers::array<T, _size>::begin() noexcept {
+    return data_;
+}
+
+template <typename T, size_t _size>
+typename containers::array<T, _size>::const_iterator
+containers::array<T, _size>::begin() const noexcept {
+    return data_;
+}
+
+template <typename T, size_t _size>
+typename containers::array<T, _size>::const_iterator
+containers::array<T, _size>::cbegin() const noexcept {
+    return data_;
+}
+
+template <typename T, size_t _size>
+typename containers::array<T, _size>::iterator
+containers::array<T, _size>::end() noexcept {
+    return data_ + size_;
+}
+
+template <typename T, size_t _size>
+typename containers::array<T, _size>::const_iterator
+containers::array<T, _size>::end() const noexcept {
+    return data_ + size_;
+}
+
+template <typename T, size_t _size>
+typename containers::array<T, _size>::const_iterator
+containers::array<T, _size>::cend() const noexcept {
     return data_ + size_;
 }
 
@@ -196,9 +236,7 @@ void containers::array<T, _size>::swap(array& other) {
 
 template <typename T, size_t _size>
 void containers::array<T, _size>::fill(const_reference value) {
-    for (size_type i = 0; i < size_; ++i) {
-        data_[i] = value;
-    }
+    detail::fill(detail::cpu_simd_level(), data_, size_, value);
 }
 
 #endif
@@ -0,0 +1,41 @@
+#ifndef CONTAINERS_BACKOFF
+#define CONTAINERS_BACKOFF
+
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace containers {
+namespace detail {
+// Wait strategy for lock-free retry loops: spins with a pause instruction for a doubling number of
+// rounds, then starts yielding the thread so that a preempted peer can make progress.
+class backoff {
+   public:
+    void pause() noexcept {
+        if (rounds_ <= spin_limit) {
+            for (unsigned i = 0; i < (1u << rounds_); ++i) relax();
+            ++rounds_;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    void reset() noexcept { rounds_ = 0; }
+
+    static void relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+   private:
+    static constexpr unsigned spin_limit = 6;
+    unsigned rounds_ = 0;
+};
+}  // namespace detail
+}  // namespace containers
+
+#endif
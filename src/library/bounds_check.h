@@ -0,0 +1,29 @@
+#ifndef CONTAINERS_BOUNDS_CHECK
+#define CONTAINERS_BOUNDS_CHECK
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+// operator[] of the contiguous containers checks the index like assert() does: in builds without
+// NDEBUG, or in any build that defines CONTAINERS_HARDENED. Release builds index unchecked, at()
+// is the accessor that always checks and throws std::out_of_range.
+#if defined(CONTAINERS_HARDENED) || !defined(NDEBUG)
+#define CONTAINERS_CHECK_INDEX(pos, size) \
+    ((pos) < (size) ? (void)0                \
+                    : containers::detail::index_out_of_range(__FILE__, __LINE__, (pos), (size)))
+#else
+#define CONTAINERS_CHECK_INDEX(pos, size) ((void)0)
+#endif
+
+namespace containers {
+namespace detail {
+[[noreturn]] inline void index_out_of_range(const char *file, int line, size_t pos,
+                                            size_t size) noexcept {
+    std::fprintf(stderr, "%s:%d: index %zu is out of range for size %zu\n", file, line, pos, size);
+    std::abort();
+}
+}  // namespace detail
+}  // namespace containers
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef CONTAINERS_CACHE_LINE
+#define CONTAINERS_CACHE_LINE
+
+#include <cstddef>
+
+namespace containers {
+// Size of the unit that cores transfer between their caches. Data written by different threads is
+// kept this far apart so that a write by one thread does not invalidate the line another one reads
+// (false sharing). std::hardware_destructive_interference_size is not available everywhere yet.
+inline constexpr size_t cache_line_size = 64;
+}  // namespace containers
+
+#endif
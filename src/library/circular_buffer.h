@@ -0,0 +1,520 @@
+#ifndef CONTAINERS_CIRCULAR_BUFFER
+#define CONTAINERS_CIRCULAR_BUFFER
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "bounds_check.h"
+#include "relocate.h"
+
+namespace containers {
+// Tag that makes a circular_buffer keep the capacity it was created with.
+struct fixed_capacity_t {
+    explicit fixed_capacity_t() = default;
+};
+inline constexpr fixed_capacity_t fixed_capacity{};
+
+namespace detail {
+// Random access iterator over a ring: `pos_` counts from the start of the buffer and is masked
+// on access, so it keeps increasing past the wrap-around point.
+template <typename T>
+class ring_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    ring_iterator() noexcept = default;
+    ring_iterator(T *data, size_t mask, size_t pos) noexcept : data_(data), mask_(mask), pos_(pos) {}
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+    ring_iterator(const ring_iterator<U> &other) noexcept
+        : data_(other.data_), mask_(other.mask_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept { return data_[pos_ & mask_]; }
+    pointer operator->() const noexcept { return data_ + (pos_ & mask_); }
+    reference operator[](difference_type n) const noexcept { return data_[(pos_ + n) & mask_]; }
+
+    ring_iterator &operator++() noexcept {
+        ++pos_;
+        return *this;
+    }
+    ring_iterator operator++(int) noexcept { return ring_iterator(data_, mask_, pos_++); }
+    ring_iterator &operator--() noexcept {
+        --pos_;
+        return *this;
+    }
+    ring_iterator operator--(int) noexcept { return ring_iterator(data_, mask_, pos_--); }
+    ring_iterator &operator+=(difference_type n) noexcept {
+        pos_ += n;
+        return *this;
+    }
+    ring_iterator &operator-=(difference_type n) noexcept {
+        pos_ -= n;
+        return *this;
+    }
+    ring_iterator operator+(difference_type n) const noexcept {
+        return ring_iterator(data_, mask_, pos_ + n);
+    }
+    ring_iterator operator-(difference_type n) const noexcept {
+        return ring_iterator(data_, mask_, pos_ - n);
+    }
+    friend ring_iterator operator+(difference_type n, const ring_iterator &it) noexcept {
+        return it + n;
+    }
+
+    template <typename U>
+    difference_type operator-(const ring_iterator<U> &other) const noexcept {
+        return static_cast<difference_type>(pos_ - other.pos_);
+    }
+    template <typename U>
+    bool operator==(const ring_iterator<U> &other) const noexcept {
+        return pos_ == other.pos_;
+    }
+    template <typename U>
+    bool operator!=(const ring_iterator<U> &other) const noexcept {
+        return pos_ != other.pos_;
+    }
+    template <typename U>
+    bool operator<(const ring_iterator<U> &other) const noexcept {
+        return pos_ < other.pos_;
+    }
+    template <typename U>
+    bool operator>(const ring_iterator<U> &other) const noexcept {
+        return pos_ > other.pos_;
+    }
+    template <typename U>
+    bool operator<=(const ring_iterator<U> &other) const noexcept {
+        return pos_ <= other.pos_;
+    }
+    template <typename U>
+    bool operator>=(const ring_iterator<U> &other) const noexcept {
+        return pos_ >= other.pos_;
+    }
+
+   private:
+    template <typename U>
+    friend class ring_iterator;
+
+    T *data_ = nullptr;
+    size_t mask_ = 0;
+    size_t pos_ = 0;
+};
+}  // namespace detail
+
+// Double-ended queue on one power-of-two buffer: the element i lives at (head + i) & mask, so
+// push and pop at either end move no other element. The buffer doubles when it is full, or a push
+// throws std::length_error if the buffer was created with fixed_capacity and holds as many
+// elements as were requested.
+template <typename T, typename Allocator = std::allocator<T>>
+class circular_buffer {
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+   private:
+    T *data_ = nullptr;
+    size_type capacity_ = 0;
+    size_type head_ = 0;
+    size_type size_ = 0;
+    // size at which a push has to grow the buffer: capacity_ for a growable buffer, the requested
+    // capacity for a fixed one, which may be below the power of two allocated
+    size_type limit_ = 0;
+    bool fixed_ = false;
+    Allocator allocator_;
+
+    T *slot(size_type index) const noexcept { return data_ + ((head_ + index) & (capacity_ - 1)); }
+    static size_type round_capacity(size_type required);
+    // moves the elements to a new buffer of `capacity` elements, starting at index 0
+    void reallocate(size_type capacity);
+    // makes room for one more element
+    void grow();
+
+   public:
+    using iterator = detail::ring_iterator<T>;
+    using const_iterator = detail::ring_iterator<const T>;
+
+    // Circular buffer Member functions
+    circular_buffer() noexcept;
+    explicit circular_buffer(size_type capacity);
+    circular_buffer(size_type capacity, fixed_capacity_t);
+    circular_buffer(std::initializer_list<T> const &items);
+    circular_buffer(const circular_buffer &other);
+    circular_buffer(circular_buffer &&other) noexcept;
+    circular_buffer &operator=(const circular_buffer &other);
+    circular_buffer &operator=(circular_buffer &&other) noexcept;
+    ~circular_buffer();
+
+    // Circular buffer Element access
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+    reference operator[](size_type pos) noexcept;
+    const_reference operator[](size_type pos) const noexcept;
+    reference front() noexcept;
+    const_reference front() const noexcept;
+    reference back() noexcept;
+    const_reference back() const noexcept;
+
+    // Circular buffer Iterators
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    // Circular buffer Capacity
+    bool empty() const noexcept;
+    bool full() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+    size_type capacity() const noexcept;
+    void reserve(size_type size);
+
+    // Circular buffer Modifiers
+    void clear() noexcept;
+    void push_back(const_reference value);
+    void push_back(value_type &&value);
+    template <typename... Args>
+    reference emplace_back(Args &&...args);
+    void push_front(const_reference value);
+    void push_front(value_type &&value);
+    template <typename... Args>
+    reference emplace_front(Args &&...args);
+    void pop_back() noexcept;
+    void pop_front() noexcept;
+    void swap(circular_buffer &other) noexcept;
+};
+}  // namespace containers
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator>::circular_buffer() noexcept {}
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator>::circular_buffer(size_type capacity) {
+    reserve(capacity);
+}
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator>::circular_buffer(size_type capacity, fixed_capacity_t) {
+    if (capacity == 0) {
+        throw std::length_error("length_error");
+    }
+    reserve(capacity);
+    limit_ = capacity;
+    fixed_ = true;
+}
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator>::circular_buffer(std::initializer_list<T> const &items) {
+    reserve(items.size());
+    for (auto &item : items) emplace_back(item);
+}
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator>::circular_buffer(const circular_buffer &other)
+    : allocator_(
+          std::allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator_)) {
+    reserve(other.capacity_);
+    for (auto &item : other) emplace_back(item);
+    limit_ = other.limit_;
+    fixed_ = other.fixed_;
+}
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator>::circular_buffer(circular_buffer &&other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      head_(std::exchange(other.head_, 0)),
+      size_(std::exchange(other.size_, 0)),
+      limit_(std::exchange(other.limit_, 0)),
+      fixed_(other.fixed_),
+      allocator_(other.allocator_) {}
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator> &containers::circular_buffer<T, Allocator>::operator=(
+    const circular_buffer &other) {
+    if (this != &other) {
+        circular_buffer copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator> &containers::circular_buffer<T, Allocator>::operator=(
+    circular_buffer &&other) noexcept {
+    if (this != &other) {
+        circular_buffer moved(std::move(other));
+        swap(moved);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator>
+containers::circular_buffer<T, Allocator>::~circular_buffer() {
+    clear();
+    if (data_) allocator_.deallocate(data_, capacity_);
+}
+
+template <typename T, typename Allocator>
+size_t containers::circular_buffer<T, Allocator>::round_capacity(size_type required) {
+    size_type capacity = 1;
+    while (capacity < required) {
+        if (capacity > std::numeric_limits<size_type>::max() / 2 / sizeof(T)) {
+            throw std::length_error("length_error");
+        }
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::reallocate(size_type capacity) {
+    T *new_data = allocator_.allocate(capacity);
+    // the elements are in at most two pieces: from head_ to the end of the buffer and the wrap
+    size_type first = capacity_ - head_ < size_ ? capacity_ - head_ : size_;
+    try {
+        detail::relocate(data_ + head_, first, new_data, data_, size_ - first, new_data + first);
+    } catch (...) {
+        allocator_.deallocate(new_data, capacity);
+        throw;
+    }
+    if (data_) allocator_.deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = capacity;
+    limit_ = capacity;
+    head_ = 0;
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::grow() {
+    if (fixed_) {
+        throw std::length_error("length_error");
+    }
+    reallocate(capacity_ ? round_capacity(capacity_ * 2) : 8);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::reference
+containers::circular_buffer<T, Allocator>::at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::const_reference
+containers::circular_buffer<T, Allocator>::at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::reference
+containers::circular_buffer<T, Allocator>::operator[](size_type pos) noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::const_reference
+containers::circular_buffer<T, Allocator>::operator[](size_type pos) const noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::reference
+containers::circular_buffer<T, Allocator>::front() noexcept {
+    CONTAINERS_CHECK_INDEX(0, size_);
+    return data_[head_];
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::const_reference
+containers::circular_buffer<T, Allocator>::front() const noexcept {
+    CONTAINERS_CHECK_INDEX(0, size_);
+    return data_[head_];
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::reference
+containers::circular_buffer<T, Allocator>::back() noexcept {
+    CONTAINERS_CHECK_INDEX(0, size_);
+    return *slot(size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::const_reference
+containers::circular_buffer<T, Allocator>::back() const noexcept {
+    CONTAINERS_CHECK_INDEX(0, size_);
+    return *slot(size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::iterator
+containers::circular_buffer<T, Allocator>::begin() noexcept {
+    return iterator(data_, capacity_ - 1, head_);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::const_iterator
+containers::circular_buffer<T, Allocator>::begin() const noexcept {
+    return const_iterator(data_, capacity_ - 1, head_);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::const_iterator
+containers::circular_buffer<T, Allocator>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::iterator
+containers::circular_buffer<T, Allocator>::end() noexcept {
+    return iterator(data_, capacity_ - 1, head_ + size_);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::const_iterator
+containers::circular_buffer<T, Allocator>::end() const noexcept {
+    return const_iterator(data_, capacity_ - 1, head_ + size_);
+}
+
+template <typename T, typename Allocator>
+typename containers::circular_buffer<T, Allocator>::const_iterator
+containers::circular_buffer<T, Allocator>::cend() const noexcept {
+    return end();
+}
+
+template <typename T, typename Allocator>
+bool containers::circular_buffer<T, Allocator>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T, typename Allocator>
+bool containers::circular_buffer<T, Allocator>::full() const noexcept {
+    return size_ == limit_;
+}
+
+template <typename T, typename Allocator>
+size_t containers::circular_buffer<T, Allocator>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, typename Allocator>
+size_t containers::circular_buffer<T, Allocator>::max_size() const noexcept {
+    // the largest power of two that can be allocated
+    size_type limit = std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+    size_type result = 1;
+    while (result <= limit / 2) result *= 2;
+    return result;
+}
+
+template <typename T, typename Allocator>
+size_t containers::circular_buffer<T, Allocator>::capacity() const noexcept {
+    return limit_;
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::reserve(size_type size) {
+    if (size > limit_) {
+        if (fixed_) {
+            throw std::length_error("length_error");
+        }
+        reallocate(round_capacity(size));
+    }
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::clear() noexcept {
+    while (size_) pop_back();
+    head_ = 0;
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::push_back(const_reference value) {
+    emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::push_back(value_type &&value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename containers::circular_buffer<T, Allocator>::reference
+containers::circular_buffer<T, Allocator>::emplace_back(Args &&...args) {
+    if (size_ == limit_) {
+        // the arguments may refer to an element that is about to move
+        T temp(std::forward<Args>(args)...);
+        grow();
+        ::new (static_cast<void *>(slot(size_))) T(std::move(temp));
+    } else {
+        ::new (static_cast<void *>(slot(size_))) T(std::forward<Args>(args)...);
+    }
+    return *slot(size_++);
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::push_front(const_reference value) {
+    emplace_front(value);
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::push_front(value_type &&value) {
+    emplace_front(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename containers::circular_buffer<T, Allocator>::reference
+containers::circular_buffer<T, Allocator>::emplace_front(Args &&...args) {
+    if (size_ == limit_) {
+        T temp(std::forward<Args>(args)...);
+        grow();
+        ::new (static_cast<void *>(slot(capacity_ - 1))) T(std::move(temp));
+    } else {
+        ::new (static_cast<void *>(slot(capacity_ - 1))) T(std::forward<Args>(args)...);
+    }
+    head_ = (head_ - 1) & (capacity_ - 1);
+    ++size_;
+    return data_[head_];
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::pop_back() noexcept {
+    if (size_ > 0) {
+        slot(--size_)->~T();
+    }
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::pop_front() noexcept {
+    if (size_ > 0) {
+        data_[head_].~T();
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --size_;
+    }
+}
+
+template <typename T, typename Allocator>
+void containers::circular_buffer<T, Allocator>::swap(circular_buffer &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(limit_, other.limit_);
+    std::swap(fixed_, other.fixed_);
+    std::swap(allocator_, other.allocator_);
+}
+
+#endif
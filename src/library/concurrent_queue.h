@@ -0,0 +1,212 @@
+#ifndef CONTAINERS_CONCURRENT_QUEUE
+#define CONTAINERS_CONCURRENT_QUEUE
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+#include "circular_buffer.h"
+#include "queue.h"
+
+namespace containers {
+// Unbounded FIFO shared by any number of threads: containers::queue behind a mutex, with consumers
+// that sleep on a condition variable while it is empty. Producers signal only when a consumer is
+// actually asleep, and consumers wait on a predicate, so a spurious wakeup costs one check instead
+// of a pop attempt. pop_all() moves out everything that is there under one lock acquisition.
+//
+// After close() pushes are refused, and the pop functions keep returning the remaining elements,
+// then report failure instead of waiting.
+template <typename T, typename _container = containers::circular_buffer<T>>
+class concurrent_queue {
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+   private:
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_;
+    queue<T, _container> queue_;
+    size_type sleepers_ = 0;
+    bool closed_ = false;
+
+    // called with the lock held and releases it, false when the queue is closed
+    template <typename... Args>
+    bool push_locked(std::unique_lock<std::mutex> &lock, Args &&...args);
+    // waits until there is an element or the queue is closed, false when there is nothing to pop
+    bool wait_locked(std::unique_lock<std::mutex> &lock);
+    void pop_locked(reference value);
+
+   public:
+    // Concurrent queue Member functions
+    concurrent_queue() = default;
+    concurrent_queue(const concurrent_queue &) = delete;
+    concurrent_queue &operator=(const concurrent_queue &) = delete;
+    ~concurrent_queue() = default;
+
+    // Concurrent queue Capacity
+    bool empty() const;
+    size_type size() const;
+    bool closed() const;
+
+    // Concurrent queue Modifiers
+    // Return false, leaving the argument untouched, when the queue is closed.
+    bool push(const_reference value);
+    bool push(value_type &&value);
+    template <typename... Args>
+    bool emplace(Args &&...args);
+    // Refuses further pushes and wakes every waiting consumer.
+    void close();
+
+    bool try_pop(reference value);
+    // Waits for an element, false once the queue is closed and empty.
+    bool pop_wait(reference value);
+    // Waits at most `timeout` for an element, false when it expired or the queue is closed and
+    // empty.
+    template <typename Rep, typename Period>
+    bool pop_for(reference value, const std::chrono::duration<Rep, Period> &timeout);
+    // Waits for an element, then moves up to max elements to out under the one lock. Returns how
+    // many, zero once the queue is closed and empty.
+    template <typename OutputIt>
+    size_type pop_all(OutputIt out, size_type max = std::numeric_limits<size_type>::max());
+    // The same without waiting.
+    template <typename OutputIt>
+    size_type try_pop_all(OutputIt out, size_type max = std::numeric_limits<size_type>::max());
+};
+}  // namespace containers
+
+template <typename T, typename _container>
+bool containers::concurrent_queue<T, _container>::empty() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.empty();
+}
+
+template <typename T, typename _container>
+size_t containers::concurrent_queue<T, _container>::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+template <typename T, typename _container>
+bool containers::concurrent_queue<T, _container>::closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+}
+
+template <typename T, typename _container>
+template <typename... Args>
+bool containers::concurrent_queue<T, _container>::push_locked(std::unique_lock<std::mutex> &lock,
+                                                             Args &&...args) {
+    if (closed_) return false;
+    queue_.emplace(std::forward<Args>(args)...);
+    bool wake = sleepers_ != 0;
+    lock.unlock();
+    // notified after the unlock, so the woken consumer does not block on the mutex
+    if (wake) not_empty_.notify_one();
+    return true;
+}
+
+template <typename T, typename _container>
+bool containers::concurrent_queue<T, _container>::push(const_reference value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return push_locked(lock, value);
+}
+
+template <typename T, typename _container>
+bool containers::concurrent_queue<T, _container>::push(value_type &&value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return push_locked(lock, std::move(value));
+}
+
+template <typename T, typename _container>
+template <typename... Args>
+bool containers::concurrent_queue<T, _container>::emplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return push_locked(lock, std::forward<Args>(args)...);
+}
+
+template <typename T, typename _container>
+void containers::concurrent_queue<T, _container>::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    not_empty_.notify_all();
+}
+
+template <typename T, typename _container>
+bool containers::concurrent_queue<T, _container>::wait_locked(std::unique_lock<std::mutex> &lock) {
+    if (queue_.empty() && !closed_) {
+        ++sleepers_;
+        not_empty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+        --sleepers_;
+    }
+    return !queue_.empty();
+}
+
+template <typename T, typename _container>
+void containers::concurrent_queue<T, _container>::pop_locked(reference value) {
+    value = std::move(queue_.front());
+    queue_.pop();
+}
+
+template <typename T, typename _container>
+bool containers::concurrent_queue<T, _container>::try_pop(reference value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    pop_locked(value);
+    return true;
+}
+
+template <typename T, typename _container>
+bool containers::concurrent_queue<T, _container>::pop_wait(reference value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!wait_locked(lock)) return false;
+    pop_locked(value);
+    return true;
+}
+
+template <typename T, typename _container>
+template <typename Rep, typename Period>
+bool containers::concurrent_queue<T, _container>::pop_for(
+    reference value, const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (queue_.empty() && !closed_) {
+        ++sleepers_;
+        not_empty_.wait_for(lock, timeout, [this] { return !queue_.empty() || closed_; });
+        --sleepers_;
+    }
+    if (queue_.empty()) return false;
+    pop_locked(value);
+    return true;
+}
+
+template <typename T, typename _container>
+template <typename OutputIt>
+size_t containers::concurrent_queue<T, _container>::pop_all(OutputIt out, size_type max) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (max == 0 || !wait_locked(lock)) return 0;
+    size_type count = 0;
+    for (; count < max && !queue_.empty(); ++count, ++out) {
+        *out = std::move(queue_.front());
+        queue_.pop();
+    }
+    return count;
+}
+
+template <typename T, typename _container>
+template <typename OutputIt>
+size_t containers::concurrent_queue<T, _container>::try_pop_all(OutputIt out, size_type max) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_type count = 0;
+    for (; count < max && !queue_.empty(); ++count, ++out) {
+        *out = std::move(queue_.front());
+        queue_.pop();
+    }
+    return count;
+}
+
+#endif
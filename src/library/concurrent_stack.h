@@ -0,0 +1,301 @@
+#ifndef CONTAINERS_CONCURRENT_STACK
+#define CONTAINERS_CONCURRENT_STACK
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "backoff.h"
+#include "cache_line.h"
+
+namespace containers {
+namespace detail {
+// index of the highest set bit, x must not be zero
+inline unsigned highest_bit(uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - static_cast<unsigned>(__builtin_clzll(x));
+#else
+    unsigned bit = 0;
+    while (x >>= 1) ++bit;
+    return bit;
+#endif
+}
+}  // namespace detail
+
+// Lock-free LIFO for any number of threads (Treiber stack). The top of the stack is one 64-bit
+// word holding the index of the top node and a tag that every successful compare-and-swap
+// increments, so a pop that read the top, slept while the node was popped and pushed again, and
+// then tries its compare-and-swap fails instead of linking a stale successor (ABA).
+//
+// Popped nodes are not freed: they go to a free list, itself a tagged Treiber stack, and are
+// reused by later pushes. A pop that reads the successor of a node another thread has just taken
+// therefore always reads valid memory, and a stack that has warmed up pushes without allocating.
+// Nodes live in chunks that double in size and are returned to the allocator by the destructor.
+//
+// With Elimination > 0 the stack also has that many exchange slots (Hendler, Shavit and
+// Yerushalmi's elimination backoff). A push or pop that loses the race for the top tries to meet
+// an opposite operation in a random slot before it retries, so under heavy contention pairs of
+// operations cancel out without touching the top at all.
+template <typename T, size_t Elimination = 0, typename Allocator = std::allocator<T>>
+class concurrent_stack {
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+   private:
+    struct node {
+        std::atomic<uint32_t> next_{0};
+        alignas(T) unsigned char storage_[sizeof(T)];
+
+        T *value() noexcept { return reinterpret_cast<T *>(storage_); }
+    };
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+
+    // Node ids start at 1, 0 is the empty list. Chunk k holds first_chunk << k nodes.
+    static constexpr size_type first_chunk = 64;
+    static constexpr size_type max_nodes = (size_type(1) << 32) - 1;
+    static constexpr size_type chunk_count = 27;
+    // how many pauses a pushed element waits in an exchange slot for a pop
+    static constexpr unsigned exchange_spins = 64;
+
+    // a list head, {tag, id} in one word
+    struct alignas(cache_line_size) head {
+        std::atomic<uint64_t> word_{0};
+    };
+    struct alignas(cache_line_size) exchange_slot {
+        std::atomic<uint64_t> word_{0};
+    };
+
+    static uint32_t id_of(uint64_t word) noexcept { return static_cast<uint32_t>(word); }
+    static uint64_t next_word(uint64_t word, uint32_t id) noexcept {
+        return ((word >> 32) + 1) << 32 | id;
+    }
+
+    head top_;
+    head free_;
+    std::array<exchange_slot, Elimination> exchange_;
+    std::atomic<node *> chunks_[chunk_count] = {};
+    std::atomic<size_type> created_{0};
+    node_allocator allocator_;
+
+    static size_type chunk_size(unsigned k) noexcept { return first_chunk << k; }
+    static unsigned chunk_of(size_type i) noexcept {
+        return detail::highest_bit(i / first_chunk + 1);
+    }
+    node *at(uint32_t id) const noexcept;
+    // takes a node from the free list or a fresh one, throws std::length_error past max_nodes
+    uint32_t acquire_node();
+    void release_node(uint32_t id) noexcept;
+    // Push side of an exchange slot: offers node id and waits a little for a pop to take it.
+    bool hand_over(uint32_t id) noexcept;
+    // Pop side: takes a node a push is offering, if the chosen slot holds one.
+    bool take_over(uint32_t &id) noexcept;
+    static size_type random_slot() noexcept;
+
+   public:
+    // Concurrent stack Member functions
+    concurrent_stack() = default;
+    concurrent_stack(const concurrent_stack &) = delete;
+    concurrent_stack &operator=(const concurrent_stack &) = delete;
+    ~concurrent_stack();
+
+    // Concurrent stack Capacity
+    // A snapshot while other threads are active.
+    bool empty() const noexcept;
+
+    // Concurrent stack Modifiers
+    template <typename... Args>
+    void emplace(Args &&...args);
+    void push(const_reference value);
+    void push(value_type &&value);
+    // Moves the top element to value, returns false when the stack is empty.
+    bool try_pop(reference value);
+};
+}  // namespace containers
+
+template <typename T, size_t Elimination, typename Allocator>
+containers::concurrent_stack<T, Elimination, Allocator>::~concurrent_stack() {
+    for (uint32_t id = id_of(top_.word_.load(std::memory_order_relaxed)); id != 0;) {
+        node *n = at(id);
+        n->value()->~T();
+        id = n->next_.load(std::memory_order_relaxed);
+    }
+    for (unsigned k = 0; k < chunk_count; ++k) {
+        node *chunk = chunks_[k].load(std::memory_order_relaxed);
+        if (chunk) allocator_.deallocate(chunk, chunk_size(k));
+    }
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+typename containers::concurrent_stack<T, Elimination, Allocator>::node *
+containers::concurrent_stack<T, Elimination, Allocator>::at(uint32_t id) const noexcept {
+    size_type i = id - 1;
+    unsigned k = chunk_of(i);
+    // a thread that holds an id has seen its chunk published, through the list head it took the
+    // id from or through created_
+    return chunks_[k].load(std::memory_order_acquire) + (i - (chunk_size(k) - first_chunk));
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+uint32_t containers::concurrent_stack<T, Elimination, Allocator>::acquire_node() {
+    uint64_t word = free_.word_.load(std::memory_order_acquire);
+    while (id_of(word) != 0) {
+        uint32_t next = at(id_of(word))->next_.load(std::memory_order_relaxed);
+        if (free_.word_.compare_exchange_weak(word, next_word(word, next),
+                                              std::memory_order_acquire,
+                                              std::memory_order_acquire)) {
+            return id_of(word);
+        }
+    }
+    size_type i = created_.fetch_add(1, std::memory_order_relaxed);
+    if (i >= max_nodes) throw std::length_error("length_error");
+    unsigned k = chunk_of(i);
+    if (!chunks_[k].load(std::memory_order_acquire)) {
+        // the threads that reach a new chunk race to allocate it, the losers give theirs back
+        node *chunk = allocator_.allocate(chunk_size(k));
+        for (size_type j = 0; j < chunk_size(k); ++j) ::new (static_cast<void *>(chunk + j)) node;
+        node *expected = nullptr;
+        if (!chunks_[k].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+            allocator_.deallocate(chunk, chunk_size(k));
+        }
+    }
+    return static_cast<uint32_t>(i + 1);
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+void containers::concurrent_stack<T, Elimination, Allocator>::release_node(uint32_t id) noexcept {
+    node *n = at(id);
+    uint64_t word = free_.word_.load(std::memory_order_relaxed);
+    do {
+        n->next_.store(id_of(word), std::memory_order_relaxed);
+    } while (!free_.word_.compare_exchange_weak(word, next_word(word, id),
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed));
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+size_t containers::concurrent_stack<T, Elimination, Allocator>::random_slot() noexcept {
+    static thread_local uint32_t seed = 2463534242u;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed % Elimination;
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+bool containers::concurrent_stack<T, Elimination, Allocator>::hand_over(uint32_t id) noexcept {
+    exchange_slot &slot = exchange_[random_slot()];
+    uint64_t word = slot.word_.load(std::memory_order_relaxed);
+    if (id_of(word) != 0) return false;
+    uint64_t offer = next_word(word, id);
+    if (!slot.word_.compare_exchange_strong(word, offer, std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        return false;
+    }
+    for (unsigned i = 0; i < exchange_spins; ++i) {
+        if (slot.word_.load(std::memory_order_relaxed) != offer) return true;
+        detail::backoff::relax();
+    }
+    // nobody came, take the offer back unless a pop takes it first
+    return !slot.word_.compare_exchange_strong(offer, next_word(offer, 0),
+                                               std::memory_order_relaxed);
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+bool containers::concurrent_stack<T, Elimination, Allocator>::take_over(uint32_t &id) noexcept {
+    exchange_slot &slot = exchange_[random_slot()];
+    uint64_t word = slot.word_.load(std::memory_order_relaxed);
+    if (id_of(word) == 0) return false;
+    if (!slot.word_.compare_exchange_strong(word, next_word(word, 0), std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+        return false;
+    }
+    id = id_of(word);
+    return true;
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+bool containers::concurrent_stack<T, Elimination, Allocator>::empty() const noexcept {
+    return id_of(top_.word_.load(std::memory_order_acquire)) == 0;
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+template <typename... Args>
+void containers::concurrent_stack<T, Elimination, Allocator>::emplace(Args &&...args) {
+    uint32_t id = acquire_node();
+    node *n = at(id);
+    try {
+        ::new (static_cast<void *>(n->value())) T(std::forward<Args>(args)...);
+    } catch (...) {
+        release_node(id);
+        throw;
+    }
+    uint64_t word = top_.word_.load(std::memory_order_relaxed);
+    detail::backoff wait;
+    for (;;) {
+        n->next_.store(id_of(word), std::memory_order_relaxed);
+        if (top_.word_.compare_exchange_weak(word, next_word(word, id), std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+            return;
+        }
+        if constexpr (Elimination > 0) {
+            if (hand_over(id)) return;
+        }
+        wait.pause();
+        word = top_.word_.load(std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+void containers::concurrent_stack<T, Elimination, Allocator>::push(const_reference value) {
+    emplace(value);
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+void containers::concurrent_stack<T, Elimination, Allocator>::push(value_type &&value) {
+    emplace(std::move(value));
+}
+
+template <typename T, size_t Elimination, typename Allocator>
+bool containers::concurrent_stack<T, Elimination, Allocator>::try_pop(reference value) {
+    uint64_t word = top_.word_.load(std::memory_order_acquire);
+    detail::backoff wait;
+    uint32_t id;
+    for (;;) {
+        id = id_of(word);
+        if (id == 0) return false;
+        // the node may be popped and reused meanwhile, then the tag has moved and the CAS fails
+        uint32_t next = at(id)->next_.load(std::memory_order_relaxed);
+        if (top_.word_.compare_exchange_weak(word, next_word(word, next),
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+            break;
+        }
+        if constexpr (Elimination > 0) {
+            if (take_over(id)) break;
+        }
+        wait.pause();
+        word = top_.word_.load(std::memory_order_acquire);
+    }
+    node *n = at(id);
+    try {
+        value = std::move(*n->value());
+    } catch (...) {
+        // the element is off the stack either way
+        n->value()->~T();
+        release_node(id);
+        throw;
+    }
+    n->value()->~T();
+    release_node(id);
+    return true;
+}
+
+#endif
@@ -0,0 +1,549 @@
+#ifndef CONTAINERS_DEQUE
+#define CONTAINERS_DEQUE
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "bounds_check.h"
+
+namespace containers {
+namespace detail {
+// Elements per deque block: a power of two that fills about 512 bytes, at least 16.
+template <typename T>
+constexpr size_t deque_block_size() {
+    size_t size = 16;
+    while (size * 2 * sizeof(T) <= 512) size *= 2;
+    return size;
+}
+
+// Random access iterator over the blocks of a deque: `pos_` is the position counted from the start
+// of the first block in the map, so element access is one load from the map and one from the block.
+template <typename T, size_t B>
+class deque_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    deque_iterator() noexcept = default;
+    deque_iterator(T *const *map, size_t pos) noexcept : map_(map), pos_(pos) {}
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+    deque_iterator(const deque_iterator<U, B> &other) noexcept
+        : map_(other.map_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept { return map_[pos_ / B][pos_ % B]; }
+    pointer operator->() const noexcept { return map_[pos_ / B] + pos_ % B; }
+    reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+    deque_iterator &operator++() noexcept {
+        ++pos_;
+        return *this;
+    }
+    deque_iterator operator++(int) noexcept { return deque_iterator(map_, pos_++); }
+    deque_iterator &operator--() noexcept {
+        --pos_;
+        return *this;
+    }
+    deque_iterator operator--(int) noexcept { return deque_iterator(map_, pos_--); }
+    deque_iterator &operator+=(difference_type n) noexcept {
+        pos_ += n;
+        return *this;
+    }
+    deque_iterator &operator-=(difference_type n) noexcept {
+        pos_ -= n;
+        return *this;
+    }
+    deque_iterator operator+(difference_type n) const noexcept {
+        return deque_iterator(map_, pos_ + n);
+    }
+    deque_iterator operator-(difference_type n) const noexcept {
+        return deque_iterator(map_, pos_ - n);
+    }
+    friend deque_iterator operator+(difference_type n, const deque_iterator &it) noexcept {
+        return it + n;
+    }
+
+    template <typename U>
+    difference_type operator-(const deque_iterator<U, B> &other) const noexcept {
+        return static_cast<difference_type>(pos_ - other.pos_);
+    }
+    template <typename U>
+    bool operator==(const deque_iterator<U, B> &other) const noexcept {
+        return pos_ == other.pos_;
+    }
+    template <typename U>
+    bool operator!=(const deque_iterator<U, B> &other) const noexcept {
+        return pos_ != other.pos_;
+    }
+    template <typename U>
+    bool operator<(const deque_iterator<U, B> &other) const noexcept {
+        return pos_ < other.pos_;
+    }
+    template <typename U>
+    bool operator>(const deque_iterator<U, B> &other) const noexcept {
+        return pos_ > other.pos_;
+    }
+    template <typename U>
+    bool operator<=(const deque_iterator<U, B> &other) const noexcept {
+        return pos_ <= other.pos_;
+    }
+    template <typename U>
+    bool operator>=(const deque_iterator<U, B> &other) const noexcept {
+        return pos_ >= other.pos_;
+    }
+
+   private:
+    template <typename U, size_t>
+    friend class deque_iterator;
+
+    T *const *map_ = nullptr;
+    size_t pos_ = 0;
+};
+}  // namespace detail
+
+// Double-ended queue of fixed-size blocks indexed by a central map of block pointers. Push and pop
+// at either end touch one block and allocate a new one only every B elements; elements never move,
+// so references to them stay valid across pushes at both ends (iterators do not, the map may be
+// reallocated). A block emptied by a pop is kept as a spare for the next block that is needed, so
+// a queue that moves through memory does not allocate in the steady state.
+template <typename T, typename Allocator = std::allocator<T>>
+class deque {
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+    static constexpr size_type B = detail::deque_block_size<T>();
+
+   private:
+    using map_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T *>;
+
+    T **map_ = nullptr;
+    size_type map_capacity_ = 0;
+    // position of the first element counted from the start of map_[0]
+    size_type start_ = 0;
+    size_type size_ = 0;
+    T *spare_ = nullptr;
+    Allocator allocator_;
+
+    T *slot(size_type pos) const noexcept { return map_[pos / B] + pos % B; }
+    void acquire_block(size_type block);
+    void release_block(size_type block) noexcept;
+    // builds an element at pos next to the used positions, allocating its block if needed
+    template <typename... Args>
+    T *construct(size_type pos, Args &&...args);
+    // recenters the used blocks in the map, doubling it when less than half of it would be free
+    void reserve_map();
+    // puts the next element of an empty deque in the middle of the map
+    void reset_start() noexcept;
+
+   public:
+    using iterator = detail::deque_iterator<T, B>;
+    using const_iterator = detail::deque_iterator<const T, B>;
+
+    // Deque Member functions
+    deque() noexcept;
+    deque(std::initializer_list<T> const &items);
+    deque(const deque &other);
+    deque(deque &&other) noexcept;
+    deque &operator=(const deque &other);
+    deque &operator=(deque &&other) noexcept;
+    ~deque();
+
+    // Deque Element access
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+    reference operator[](size_type pos) noexcept;
+    const_reference operator[](size_type pos) const noexcept;
+    reference front() noexcept;
+    const_reference front() const noexcept;
+    reference back() noexcept;
+    const_reference back() const noexcept;
+
+    // Deque Iterators
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    // Deque Capacity
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+    // Frees the spare block and shrinks the map to the blocks in use.
+    void shrink_to_fit();
+
+    // Deque Modifiers
+    void clear() noexcept;
+    void push_back(const_reference value);
+    void push_back(value_type &&value);
+    template <typename... Args>
+    reference emplace_back(Args &&...args);
+    void push_front(const_reference value);
+    void push_front(value_type &&value);
+    template <typename... Args>
+    reference emplace_front(Args &&...args);
+    void pop_back() noexcept;
+    void pop_front() noexcept;
+    void swap(deque &other) noexcept;
+};
+}  // namespace containers
+
+template <typename T, typename Allocator>
+containers::deque<T, Allocator>::deque() noexcept {}
+
+template <typename T, typename Allocator>
+containers::deque<T, Allocator>::deque(std::initializer_list<T> const &items) {
+    for (auto &item : items) emplace_back(item);
+}
+
+template <typename T, typename Allocator>
+containers::deque<T, Allocator>::deque(const deque &other)
+    : allocator_(
+          std::allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator_)) {
+    for (auto &item : other) emplace_back(item);
+}
+
+template <typename T, typename Allocator>
+containers::deque<T, Allocator>::deque(deque &&other) noexcept
+    : map_(std::exchange(other.map_, nullptr)),
+      map_capacity_(std::exchange(other.map_capacity_, 0)),
+      start_(std::exchange(other.start_, 0)),
+      size_(std::exchange(other.size_, 0)),
+      spare_(std::exchange(other.spare_, nullptr)),
+      allocator_(other.allocator_) {}
+
+template <typename T, typename Allocator>
+containers::deque<T, Allocator> &containers::deque<T, Allocator>::operator=(const deque &other) {
+    if (this != &other) {
+        deque copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator>
+containers::deque<T, Allocator> &containers::deque<T, Allocator>::operator=(
+    deque &&other) noexcept {
+    if (this != &other) {
+        deque moved(std::move(other));
+        swap(moved);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator>
+containers::deque<T, Allocator>::~deque() {
+    clear();
+    if (spare_) allocator_.deallocate(spare_, B);
+    if (map_) map_allocator(allocator_).deallocate(map_, map_capacity_);
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::acquire_block(size_type block) {
+    if (!map_[block]) {
+        map_[block] = spare_ ? std::exchange(spare_, nullptr) : allocator_.allocate(B);
+    }
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::release_block(size_type block) noexcept {
+    if (spare_) {
+        allocator_.deallocate(map_[block], B);
+    } else {
+        spare_ = map_[block];
+    }
+    map_[block] = nullptr;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+T *containers::deque<T, Allocator>::construct(size_type pos, Args &&...args) {
+    size_type block = pos / B;
+    bool fresh = !map_[block];
+    acquire_block(block);
+    T *item = slot(pos);
+    try {
+        ::new (static_cast<void *>(item)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        // only the blocks holding elements may stay in the map
+        if (fresh) release_block(block);
+        throw;
+    }
+    return item;
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::reset_start() noexcept {
+    start_ = map_capacity_ / 2 * B;
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::reserve_map() {
+    size_type first = start_ / B;
+    size_type used = size_ ? (start_ + size_ - 1) / B - first + 1 : 0;
+    // room for one more block at either end after recentering
+    size_type capacity = map_capacity_;
+    if ((used + 2) * 2 > capacity) {
+        if (capacity > std::numeric_limits<size_type>::max() / 2 / sizeof(T *)) {
+            throw std::length_error("length_error");
+        }
+        capacity = capacity ? capacity * 2 : 8;
+    }
+    size_type new_first = (capacity - used) / 2;
+    if (capacity != map_capacity_) {
+        T **new_map = map_allocator(allocator_).allocate(capacity);
+        for (size_type i = 0; i < capacity; ++i) new_map[i] = nullptr;
+        if (used) std::memcpy(new_map + new_first, map_ + first, used * sizeof(T *));
+        if (map_) map_allocator(allocator_).deallocate(map_, map_capacity_);
+        map_ = new_map;
+        map_capacity_ = capacity;
+    } else if (new_first != first) {
+        std::memmove(map_ + new_first, map_ + first, used * sizeof(T *));
+        // clear the slots the blocks left, the others now hold blocks again
+        for (size_type i = first; i < first + used; ++i) {
+            if (i < new_first || i >= new_first + used) map_[i] = nullptr;
+        }
+    }
+    if (size_) {
+        start_ = new_first * B + start_ % B;
+    } else {
+        reset_start();
+    }
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::reference containers::deque<T, Allocator>::at(
+    size_type pos) {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return *slot(start_ + pos);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::const_reference containers::deque<T, Allocator>::at(
+    size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return *slot(start_ + pos);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::reference containers::deque<T, Allocator>::operator[](
+    size_type pos) noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return *slot(start_ + pos);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::const_reference
+containers::deque<T, Allocator>::operator[](size_type pos) const noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return *slot(start_ + pos);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::reference
+containers::deque<T, Allocator>::front() noexcept {
+    CONTAINERS_CHECK_INDEX(0, size_);
+    return *slot(start_);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::const_reference containers::deque<T, Allocator>::front()
+    const noexcept {
+    CONTAINERS_CHECK_INDEX(0, size_);
+    return *slot(start_);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::reference
+containers::deque<T, Allocator>::back() noexcept {
+    CONTAINERS_CHECK_INDEX(0, size_);
+    return *slot(start_ + size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::const_reference containers::deque<T, Allocator>::back()
+    const noexcept {
+    CONTAINERS_CHECK_INDEX(0, size_);
+    return *slot(start_ + size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::iterator
+containers::deque<T, Allocator>::begin() noexcept {
+    return iterator(map_, start_);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::const_iterator containers::deque<T, Allocator>::begin()
+    const noexcept {
+    return const_iterator(map_, start_);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::const_iterator containers::deque<T, Allocator>::cbegin()
+    const noexcept {
+    return begin();
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::iterator containers::deque<T, Allocator>::end() noexcept {
+    return iterator(map_, start_ + size_);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::const_iterator containers::deque<T, Allocator>::end()
+    const noexcept {
+    return const_iterator(map_, start_ + size_);
+}
+
+template <typename T, typename Allocator>
+typename containers::deque<T, Allocator>::const_iterator containers::deque<T, Allocator>::cend()
+    const noexcept {
+    return end();
+}
+
+template <typename T, typename Allocator>
+bool containers::deque<T, Allocator>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T, typename Allocator>
+size_t containers::deque<T, Allocator>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, typename Allocator>
+size_t containers::deque<T, Allocator>::max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::shrink_to_fit() {
+    if (spare_) allocator_.deallocate(std::exchange(spare_, nullptr), B);
+    if (!map_) return;
+    size_type used = size_ ? (start_ + size_ - 1) / B - start_ / B + 1 : 0;
+    if (used == 0) {
+        map_allocator(allocator_).deallocate(map_, map_capacity_);
+        map_ = nullptr;
+        map_capacity_ = 0;
+        start_ = 0;
+        return;
+    }
+    // keep one free slot at either end
+    size_type capacity = used + 2;
+    if (capacity >= map_capacity_) return;
+    T **new_map = map_allocator(allocator_).allocate(capacity);
+    new_map[0] = nullptr;
+    new_map[capacity - 1] = nullptr;
+    std::memcpy(new_map + 1, map_ + start_ / B, used * sizeof(T *));
+    map_allocator(allocator_).deallocate(map_, map_capacity_);
+    map_ = new_map;
+    map_capacity_ = capacity;
+    start_ = B + start_ % B;
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_type pos = start_; pos != start_ + size_; ++pos) slot(pos)->~T();
+    }
+    if (size_) {
+        size_type last = (start_ + size_ - 1) / B;
+        for (size_type block = start_ / B; block <= last; ++block) release_block(block);
+    }
+    size_ = 0;
+    reset_start();
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::push_back(const_reference value) {
+    emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::push_back(value_type &&value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename containers::deque<T, Allocator>::reference containers::deque<T, Allocator>::emplace_back(
+    Args &&...args) {
+    if ((start_ + size_) / B >= map_capacity_) reserve_map();
+    size_type pos = start_ + size_;
+    T *item = construct(pos, std::forward<Args>(args)...);
+    ++size_;
+    return *item;
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::push_front(const_reference value) {
+    emplace_front(value);
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::push_front(value_type &&value) {
+    emplace_front(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename containers::deque<T, Allocator>::reference containers::deque<T, Allocator>::emplace_front(
+    Args &&...args) {
+    if (start_ == 0) reserve_map();
+    size_type pos = start_ - 1;
+    T *item = construct(pos, std::forward<Args>(args)...);
+    start_ = pos;
+    ++size_;
+    return *item;
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::pop_back() noexcept {
+    if (size_ == 0) return;
+    size_type pos = start_ + --size_;
+    slot(pos)->~T();
+    if (size_ == 0) {
+        release_block(pos / B);
+        reset_start();
+    } else if (pos % B == 0) {
+        release_block(pos / B);
+    }
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::pop_front() noexcept {
+    if (size_ == 0) return;
+    size_type pos = start_++;
+    --size_;
+    slot(pos)->~T();
+    if (size_ == 0) {
+        release_block(pos / B);
+        reset_start();
+    } else if (start_ % B == 0) {
+        release_block(pos / B);
+    }
+}
+
+template <typename T, typename Allocator>
+void containers::deque<T, Allocator>::swap(deque &other) noexcept {
+    std::swap(map_, other.map_);
+    std::swap(map_capacity_, other.map_capacity_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+    std::swap(spare_, other.spare_);
+    std::swap(allocator_, other.allocator_);
+}
+
+#endif
@@ -0,0 +1,253 @@
+#ifndef CONTAINERS_FORK_JOIN
+#define CONTAINERS_FORK_JOIN
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "backoff.h"
+#include "vector.h"
+#include "work_stealing_deque.h"
+
+// Fork-join scheduler on work-stealing deques. Every thread of the pool owns a deque: a fork
+// pushes the second half of the work onto the forking thread's deque and runs the first half
+// itself, idle threads steal the oldest (largest) pieces from the others. There is no shared task
+// queue, so the threads only contend when one of them runs out of work.
+namespace containers {
+namespace parallel {
+class fork_join_pool {
+   public:
+    // `threads` counts the calling thread, so a pool of one runs everything on the caller.
+    explicit fork_join_pool(size_t threads = std::thread::hardware_concurrency());
+    fork_join_pool(const fork_join_pool &) = delete;
+    fork_join_pool &operator=(const fork_join_pool &) = delete;
+    ~fork_join_pool();
+
+    size_t size() const noexcept { return threads_; }
+
+    // Runs a() and b(), possibly in parallel, and returns when both are done. If either throws,
+    // the first exception is rethrown after both have finished. May be called from inside tasks of
+    // this pool; calls from outside the pool are served one at a time.
+    template <typename A, typename B>
+    void invoke(A &&a, B &&b);
+
+    // Calls body(begin, end) on pieces of [first, last) no longer than grain, splitting the range
+    // in halves so that thieves take large pieces. grain 0 picks about eight pieces per thread.
+    template <typename Body>
+    void parallel_for(size_t first, size_t last, Body &&body, size_t grain = 0);
+
+   private:
+    struct task {
+        void (*invoke_)(task *);
+        std::atomic<bool> done_{false};
+        std::exception_ptr error_;
+    };
+    template <typename Function>
+    struct bound_task : task {
+        explicit bound_task(Function &function) : function_(function) {
+            this->invoke_ = [](task *self) { static_cast<bound_task *>(self)->function_(); };
+        }
+        Function &function_;
+    };
+    struct worker_id {
+        const fork_join_pool *pool;
+        size_t index;
+    };
+
+    // runs a task and marks it done, keeping its exception
+    static void execute(task *t) noexcept;
+    // steals one task from another thread, starting the search at a random victim
+    bool steal(size_t self, task *&t) noexcept;
+    // runs stolen tasks until t is done
+    void wait_for(size_t self, task &t);
+    void work(size_t self);
+    // tells the workers to exit and joins them
+    void shut_down() noexcept;
+    template <typename A, typename B>
+    void fork(size_t self, A &a, B &b);
+
+    // fixed before the workers start, they read it while workers_ is still being filled
+    size_t threads_;
+    vector<std::thread> workers_;
+    // one per thread, index 0 belongs to the thread that called from outside
+    std::unique_ptr<work_stealing_deque<task *>[]> deques_;
+    std::mutex outside_mutex_;  // one outside caller at a time
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> busy_{false};
+    bool stop_ = false;
+
+    static inline thread_local worker_id current_{nullptr, 0};
+};
+
+// Pool shared by parallel_for when none is passed, sized to the hardware.
+inline fork_join_pool &default_fork_join_pool() {
+    static fork_join_pool pool;
+    return pool;
+}
+
+// Calls f(element) for every element of a contiguous container, splitting it on a fork-join pool.
+// Unlike for_each, a thread whose pieces finish early does not go idle: it steals half of what
+// another thread has left, which pays off when the elements take unequal time.
+template <typename Container, typename Function>
+void parallel_for(Container &container, Function f,
+                  fork_join_pool &pool = default_fork_join_pool());
+}  // namespace parallel
+}  // namespace containers
+
+inline containers::parallel::fork_join_pool::fork_join_pool(size_t threads)
+    : threads_(std::max<size_t>(threads, 1)) {
+    deques_.reset(new work_stealing_deque<task *>[threads_]);
+    try {
+        for (size_t i = 1; i < threads_; ++i) workers_.emplace_back([this, i] { work(i); });
+    } catch (...) {
+        // the workers already running would make the destructor of workers_ terminate
+        shut_down();
+        throw;
+    }
+}
+
+inline containers::parallel::fork_join_pool::~fork_join_pool() { shut_down(); }
+
+inline void containers::parallel::fork_join_pool::shut_down() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) worker.join();
+}
+
+inline void containers::parallel::fork_join_pool::execute(task *t) noexcept {
+    try {
+        t->invoke_(t);
+    } catch (...) {
+        t->error_ = std::current_exception();
+    }
+    t->done_.store(true, std::memory_order_release);
+}
+
+inline bool containers::parallel::fork_join_pool::steal(size_t self, task *&t) noexcept {
+    static thread_local uint32_t seed = 2463534242u;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    size_t threads = size();
+    size_t start = seed % threads;
+    for (size_t i = 0; i < threads; ++i) {
+        size_t victim = (start + i) % threads;
+        if (victim != self && deques_[victim].steal(t)) return true;
+    }
+    return false;
+}
+
+inline void containers::parallel::fork_join_pool::wait_for(size_t self, task &t) {
+    detail::backoff wait;
+    while (!t.done_.load(std::memory_order_acquire)) {
+        task *other;
+        if (steal(self, other)) {
+            execute(other);
+            wait.reset();
+        } else {
+            wait.pause();
+        }
+    }
+}
+
+inline void containers::parallel::fork_join_pool::work(size_t self) {
+    current_ = {this, self};
+    detail::backoff wait;
+    for (;;) {
+        task *t;
+        if (steal(self, t)) {
+            execute(t);
+            wait.reset();
+            continue;
+        }
+        if (busy_.load(std::memory_order_acquire)) {
+            wait.pause();
+            continue;
+        }
+        // nothing runs on the pool, sleep until an outside caller starts something
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [this] { return stop_ || busy_.load(std::memory_order_relaxed); });
+        if (stop_) return;
+    }
+}
+
+template <typename A, typename B>
+void containers::parallel::fork_join_pool::fork(size_t self, A &a, B &b) {
+    bound_task<B> second(b);
+    deques_[self].push(&second);
+    std::exception_ptr error;
+    try {
+        a();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    task *t;
+    // everything a() forked has been joined, so the newest task here is `second` unless a thief
+    // took it
+    if (deques_[self].pop(t)) {
+        execute(t);
+    } else {
+        wait_for(self, second);
+    }
+    if (error) std::rethrow_exception(error);
+    if (second.error_) std::rethrow_exception(second.error_);
+}
+
+template <typename A, typename B>
+void containers::parallel::fork_join_pool::invoke(A &&a, B &&b) {
+    if (current_.pool == this) {
+        fork(current_.index, a, b);
+        return;
+    }
+    std::lock_guard<std::mutex> outside_lock(outside_mutex_);
+    // the caller is thread 0 of the pool until both halves are done
+    struct leave {
+        fork_join_pool *pool;
+        worker_id outer;
+        ~leave() {
+            pool->busy_.store(false, std::memory_order_release);
+            current_ = outer;
+        }
+    } guard{this, std::exchange(current_, worker_id{this, 0})};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        busy_.store(true, std::memory_order_release);
+    }
+    wake_.notify_all();
+    fork(0, a, b);
+}
+
+template <typename Body>
+void containers::parallel::fork_join_pool::parallel_for(size_t first, size_t last, Body &&body,
+                                                        size_t grain) {
+    if (first >= last) return;
+    if (grain == 0) grain = std::max<size_t>(1, (last - first) / (size() * 8));
+    if (last - first <= grain) {
+        body(first, last);
+        return;
+    }
+    size_t middle = first + (last - first) / 2;
+    invoke([&] { parallel_for(first, middle, body, grain); },
+           [&] { parallel_for(middle, last, body, grain); });
+}
+
+template <typename Container, typename Function>
+void containers::parallel::parallel_for(Container &container, Function f, fork_join_pool &pool) {
+    auto *data = container.data();
+    pool.parallel_for(0, container.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) f(data[i]);
+    });
+}
+
+#endif
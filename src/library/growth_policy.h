@@ -0,0 +1,63 @@
+#ifndef CONTAINERS_GROWTH_POLICY
+#define CONTAINERS_GROWTH_POLICY
+
+#include <cstddef>
+
+namespace containers {
+// A growth policy tells a vector which capacity to allocate when it needs room for `required`
+// elements of `element_size` bytes while holding `capacity` of them. The result is never less than
+// `required`.
+
+// Multiplies the capacity by Numerator / Denominator.
+template <size_t Numerator, size_t Denominator>
+struct factor_growth {
+    static_assert(Numerator > Denominator, "the growth factor must be greater than one");
+
+    static size_t next_capacity(size_t capacity, size_t required, size_t) noexcept {
+        size_t grown = capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator;
+        return grown > required ? grown : required;
+    }
+};
+
+// Fastest growth, up to half of the buffer stays unused. The default policy of vector.
+using doubling_growth = factor_growth<2, 1>;
+
+// Less wasted memory at the cost of more reallocations.
+using one_and_half_growth = factor_growth<3, 2>;
+
+// Grows as Base and rounds buffers of at least a page up to whole pages, so the tail of the last
+// page is not wasted.
+template <typename Base = doubling_growth, size_t PageSize = 4096>
+struct page_rounded_growth {
+    static_assert((PageSize & (PageSize - 1)) == 0, "the page size must be a power of two");
+
+    static size_t next_capacity(size_t capacity, size_t required, size_t element_size) noexcept {
+        size_t result = Base::next_capacity(capacity, required, element_size);
+        size_t bytes = result * element_size;
+        if (bytes >= PageSize) {
+            result = ((bytes + PageSize - 1) & ~(PageSize - 1)) / element_size;
+        }
+        return result;
+    }
+};
+
+// Grows as Base and rounds the buffer up to the size classes of jemalloc/tcmalloc-style allocators
+// (four classes per power of two), using the bytes the allocator would hand out anyway.
+template <typename Base = doubling_growth>
+struct size_class_growth {
+    static size_t size_class(size_t bytes) noexcept {
+        if (bytes <= 16) return 16;
+        size_t power = 1;
+        while (power * 2 < bytes) power *= 2;
+        size_t step = power / 4 ? power / 4 : 1;
+        return (bytes + step - 1) / step * step;
+    }
+
+    static size_t next_capacity(size_t capacity, size_t required, size_t element_size) noexcept {
+        size_t result = Base::next_capacity(capacity, required, element_size);
+        return size_class(result * element_size) / element_size;
+    }
+};
+}  // namespace containers
+
+#endif
@@ -0,0 +1,460 @@
+#ifndef CONTAINERS_INTRUSIVE_LIST
+#define CONTAINERS_INTRUSIVE_LIST
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace containers {
+// Links of an object that can be put into an intrusive_list. An object can be in one list per
+// hook it has. Copies of an object start unlinked, a destroyed object leaves its list.
+class intrusive_list_hook {
+   public:
+    intrusive_list_hook() noexcept = default;
+    intrusive_list_hook(const intrusive_list_hook &) noexcept {}
+    intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept { return *this; }
+    ~intrusive_list_hook() { unlink(); }
+
+    bool is_linked() const noexcept { return next_ != nullptr; }
+    // Removes the object from the list it is in, does nothing when it is in none.
+    void unlink() noexcept;
+
+   private:
+    template <typename T, intrusive_list_hook T::*Member>
+    friend class intrusive_list;
+
+    intrusive_list_hook *prev_ = nullptr;
+    intrusive_list_hook *next_ = nullptr;
+    // the object that holds the hook, set when it is linked
+    void *owner_ = nullptr;
+};
+
+// Doubly linked list of objects that carry their links in the member `Member`, declared as
+// intrusive_list<T, &T::hook>. The list neither allocates nor copies: it links the objects the
+// caller owns, and the objects must outlive their membership. size() walks the list because an
+// object can unlink itself without the list knowing.
+template <typename T, intrusive_list_hook T::*Member>
+class intrusive_list {
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+   private:
+    using hook = intrusive_list_hook;
+
+    // ring closed by end_, as in list
+    hook end_;
+
+    static hook *hook_of(reference value) noexcept { return &(value.*Member); }
+    static T *owner(const hook *ptr) noexcept;
+    // links the chain first..last (both included) in front of pos
+    static void link(hook *pos, hook *first, hook *last) noexcept;
+    // cuts the chain first..last (both included) out of its list
+    static void unlink(hook *first, hook *last) noexcept;
+    void steal(intrusive_list &other) noexcept;
+
+   public:
+    class iterator {
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        iterator(hook *ptr = nullptr) : ptr_(ptr) {}
+
+        reference operator*() const { return *owner(ptr_); }
+        pointer operator->() const { return owner(ptr_); }
+
+        iterator &operator++() {
+            ptr_ = ptr_->next_;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator result = *this;
+            ptr_ = ptr_->next_;
+            return result;
+        }
+        iterator &operator--() {
+            ptr_ = ptr_->prev_;
+            return *this;
+        }
+        iterator operator--(int) {
+            iterator result = *this;
+            ptr_ = ptr_->prev_;
+            return result;
+        }
+        bool operator==(const iterator &other) const { return ptr_ == other.ptr_; }
+        bool operator!=(const iterator &other) const { return ptr_ != other.ptr_; }
+        hook *get_ptr() const { return ptr_; }
+
+       private:
+        hook *ptr_;
+    };
+
+    class const_iterator {
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator(const hook *ptr = nullptr) : ptr_(ptr) {}
+        const_iterator(const iterator &other) : ptr_(other.get_ptr()) {}
+
+        reference operator*() const { return *owner(ptr_); }
+        pointer operator->() const { return owner(ptr_); }
+
+        const_iterator &operator++() {
+            ptr_ = ptr_->next_;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator result = *this;
+            ptr_ = ptr_->next_;
+            return result;
+        }
+        const_iterator &operator--() {
+            ptr_ = ptr_->prev_;
+            return *this;
+        }
+        const_iterator operator--(int) {
+            const_iterator result = *this;
+            ptr_ = ptr_->prev_;
+            return result;
+        }
+        friend bool operator==(const const_iterator &left, const const_iterator &right) {
+            return left.ptr_ == right.ptr_;
+        }
+        friend bool operator!=(const const_iterator &left, const const_iterator &right) {
+            return left.ptr_ != right.ptr_;
+        }
+        // the list links the objects, so a list method may relink them through a const_iterator
+        hook *get_ptr() const { return const_cast<hook *>(ptr_); }
+
+       private:
+        const hook *ptr_;
+    };
+
+    // Intrusive list Functions
+    intrusive_list() noexcept;
+    intrusive_list(const intrusive_list &) = delete;
+    intrusive_list(intrusive_list &&other) noexcept;
+    intrusive_list &operator=(const intrusive_list &) = delete;
+    intrusive_list &operator=(intrusive_list &&other) noexcept;
+    ~intrusive_list();
+
+    // Intrusive list Element access
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    // Intrusive list Iterators
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+    // iterator to an object that is in a list of this type
+    static iterator iterator_to(reference value) noexcept;
+    static const_iterator iterator_to(const_reference value) noexcept;
+
+    // Intrusive list Capacity
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // Intrusive list Modifiers
+    void clear() noexcept;
+    iterator insert(const_iterator pos, reference value);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last) noexcept;
+    void push_back(reference value);
+    void push_front(reference value);
+    void pop_back();
+    void pop_front();
+    void swap(intrusive_list &other) noexcept;
+    void splice(const_iterator pos, intrusive_list &other) noexcept;
+    void splice(const_iterator pos, intrusive_list &other, const_iterator it) noexcept;
+    void splice(const_iterator pos, intrusive_list &other, const_iterator first,
+                const_iterator last) noexcept;
+};
+}  // namespace containers
+
+inline void containers::intrusive_list_hook::unlink() noexcept {
+    if (!next_) return;
+    prev_->next_ = next_;
+    next_->prev_ = prev_;
+    prev_ = next_ = nullptr;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+containers::intrusive_list<T, Member>::intrusive_list() noexcept {
+    end_.prev_ = end_.next_ = &end_;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+containers::intrusive_list<T, Member>::intrusive_list(intrusive_list &&other) noexcept {
+    end_.prev_ = end_.next_ = &end_;
+    steal(other);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+containers::intrusive_list<T, Member> &containers::intrusive_list<T, Member>::operator=(
+    intrusive_list &&other) noexcept {
+    if (this != &other) {
+        clear();
+        steal(other);
+    }
+    return *this;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+containers::intrusive_list<T, Member>::~intrusive_list() {
+    clear();
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+T *containers::intrusive_list<T, Member>::owner(const hook *ptr) noexcept {
+    // A back pointer rather than the offset of the hook: the offset of a member is only portable
+    // for standard-layout types, and polymorphic T is the common case for intrusive lists.
+    return static_cast<T *>(ptr->owner_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::link(hook *pos, hook *first, hook *last) noexcept {
+    first->prev_ = pos->prev_;
+    last->next_ = pos;
+    pos->prev_->next_ = first;
+    pos->prev_ = last;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::unlink(hook *first, hook *last) noexcept {
+    first->prev_->next_ = last->next_;
+    last->next_->prev_ = first->prev_;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::steal(intrusive_list &other) noexcept {
+    // this list must be empty
+    if (other.empty()) return;
+    hook *first = other.end_.next_;
+    hook *last = other.end_.prev_;
+    other.end_.prev_ = other.end_.next_ = &other.end_;
+    link(&end_, first, last);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::reference
+containers::intrusive_list<T, Member>::front() {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    return *owner(end_.next_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::const_reference
+containers::intrusive_list<T, Member>::front() const {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    return *owner(end_.next_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::reference
+containers::intrusive_list<T, Member>::back() {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    return *owner(end_.prev_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::const_reference
+containers::intrusive_list<T, Member>::back() const {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    return *owner(end_.prev_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::iterator
+containers::intrusive_list<T, Member>::begin() noexcept {
+    return iterator(end_.next_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::const_iterator
+containers::intrusive_list<T, Member>::begin() const noexcept {
+    return const_iterator(end_.next_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::const_iterator
+containers::intrusive_list<T, Member>::cbegin() const noexcept {
+    return const_iterator(end_.next_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::iterator
+containers::intrusive_list<T, Member>::end() noexcept {
+    return iterator(&end_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::const_iterator
+containers::intrusive_list<T, Member>::end() const noexcept {
+    return const_iterator(&end_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::const_iterator
+containers::intrusive_list<T, Member>::cend() const noexcept {
+    return const_iterator(&end_);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::iterator
+containers::intrusive_list<T, Member>::iterator_to(reference value) noexcept {
+    return iterator(hook_of(value));
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::const_iterator
+containers::intrusive_list<T, Member>::iterator_to(const_reference value) noexcept {
+    return const_iterator(&(value.*Member));
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+bool containers::intrusive_list<T, Member>::empty() const noexcept {
+    return end_.next_ == &end_;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+size_t containers::intrusive_list<T, Member>::size() const noexcept {
+    size_type count = 0;
+    for (const hook *curr = end_.next_; curr != &end_; curr = curr->next_) ++count;
+    return count;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::clear() noexcept {
+    hook *curr = end_.next_;
+    while (curr != &end_) {
+        hook *next = curr->next_;
+        curr->prev_ = curr->next_ = nullptr;
+        curr = next;
+    }
+    end_.prev_ = end_.next_ = &end_;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::iterator
+containers::intrusive_list<T, Member>::insert(const_iterator pos, reference value) {
+    hook *ptr = hook_of(value);
+    if (ptr->is_linked()) {
+        throw std::invalid_argument("invalid_argument");
+    }
+    ptr->owner_ = &value;
+    link(pos.get_ptr(), ptr, ptr);
+    return iterator(ptr);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::iterator
+containers::intrusive_list<T, Member>::erase(const_iterator pos) {
+    if (pos == end()) {
+        throw std::out_of_range("out_of_range");
+    }
+    hook *ptr = pos.get_ptr();
+    iterator next(ptr->next_);
+    ptr->unlink();
+    return next;
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+typename containers::intrusive_list<T, Member>::iterator
+containers::intrusive_list<T, Member>::erase(const_iterator first, const_iterator last) noexcept {
+    hook *curr = first.get_ptr();
+    while (curr != last.get_ptr()) {
+        hook *next = curr->next_;
+        curr->unlink();
+        curr = next;
+    }
+    return iterator(curr);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::push_back(reference value) {
+    insert(end(), value);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::push_front(reference value) {
+    insert(begin(), value);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    end_.prev_->unlink();
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    end_.next_->unlink();
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::swap(intrusive_list &other) noexcept {
+    if (this == &other) return;
+    intrusive_list temp(std::move(other));
+    other.steal(*this);
+    steal(temp);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::splice(const_iterator pos,
+                                                   intrusive_list &other) noexcept {
+    if (this == &other) return;
+    splice(pos, other, other.begin(), other.end());
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::splice(const_iterator pos, intrusive_list &other,
+                                                   const_iterator it) noexcept {
+    (void)other;
+    hook *ptr = it.get_ptr();
+    if (pos.get_ptr() == ptr || pos.get_ptr() == ptr->next_) return;
+    unlink(ptr, ptr);
+    link(pos.get_ptr(), ptr, ptr);
+}
+
+template <typename T, containers::intrusive_list_hook T::*Member>
+void containers::intrusive_list<T, Member>::splice(const_iterator pos, intrusive_list &other,
+                                                   const_iterator first,
+                                                   const_iterator last) noexcept {
+    // pos must not be inside [first, last)
+    (void)other;
+    if (first == last) return;
+    hook *head = first.get_ptr();
+    hook *tail = last.get_ptr()->prev_;
+    unlink(head, tail);
+    link(pos.get_ptr(), head, tail);
+}
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef CONTAINERS_ITERATOR
+#define CONTAINERS_ITERATOR
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace containers {
+namespace detail {
+// Containers' own iterators do not specialize std::iterator_traits, so ranges are inspected through
+// the operations they provide.
+template <typename It, typename = void>
+struct is_iterator : std::false_type {};
+
+template <typename It>
+struct is_iterator<It, std::void_t<decltype(*std::declval<It &>()), decltype(++std::declval<It &>())>>
+    : std::true_type {};
+
+template <typename It>
+inline constexpr bool is_iterator_v = is_iterator<It>::value;
+
+template <typename It, typename = void>
+struct iterator_category {
+    using type = void;  // unknown, treated as multi-pass
+};
+
+template <typename It>
+struct iterator_category<It, std::void_t<typename std::iterator_traits<It>::iterator_category>> {
+    using type = typename std::iterator_traits<It>::iterator_category;
+};
+
+template <typename It>
+inline constexpr bool is_single_pass_v =
+    std::is_same_v<typename iterator_category<It>::type, std::input_iterator_tag>;
+
+template <typename It>
+inline constexpr bool is_random_access_v =
+    std::is_base_of_v<std::random_access_iterator_tag, typename iterator_category<It>::type>;
+
+// Number of elements in [first, last), O(1) for random access iterators.
+template <typename It>
+size_t distance(It first, It last) {
+    if constexpr (is_random_access_v<It>) {
+        return static_cast<size_t>(last - first);
+    } else {
+        size_t n = 0;
+        for (; first != last; ++first) ++n;
+        return n;
+    }
+}
+}  // namespace detail
+
+// Iterator over contiguous storage shared by array, vector and small_vector. T is const for
+// const_iterator, and an iterator converts to the matching const_iterator.
+template <typename T>
+class contiguous_iterator {
+   public:
+#if __cplusplus >= 202002L
+    using iterator_concept = std::contiguous_iterator_tag;
+#endif
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    contiguous_iterator() noexcept : ptr_(nullptr) {}
+    contiguous_iterator(T *ptr) noexcept : ptr_(ptr) {}
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+    contiguous_iterator(const contiguous_iterator<U> &other) noexcept : ptr_(other.get_ptr()) {}
+
+    reference operator*() const noexcept { return *ptr_; }
+    pointer operator->() const noexcept { return ptr_; }
+    reference operator[](difference_type n) const noexcept { return ptr_[n]; }
+
+    contiguous_iterator &operator++() noexcept {
+        ++ptr_;
+        return *this;
+    }
+    contiguous_iterator operator++(int) noexcept { return contiguous_iterator(ptr_++); }
+    contiguous_iterator &operator--() noexcept {
+        --ptr_;
+        return *this;
+    }
+    contiguous_iterator operator--(int) noexcept { return contiguous_iterator(ptr_--); }
+    contiguous_iterator &operator+=(difference_type n) noexcept {
+        ptr_ += n;
+        return *this;
+    }
+    contiguous_iterator &operator-=(difference_type n) noexcept {
+        ptr_ -= n;
+        return *this;
+    }
+    contiguous_iterator operator+(difference_type n) const noexcept {
+        return contiguous_iterator(ptr_ + n);
+    }
+    contiguous_iterator operator-(difference_type n) const noexcept {
+        return contiguous_iterator(ptr_ - n);
+    }
+    friend contiguous_iterator operator+(difference_type n,
+                                         const contiguous_iterator &it) noexcept {
+        return it + n;
+    }
+
+    T *get_ptr() const noexcept { return ptr_; }
+
+   private:
+    T *ptr_;
+};
+
+// Distance and comparisons also work between an iterator and a const_iterator.
+template <typename T, typename U>
+std::ptrdiff_t operator-(const contiguous_iterator<T> &left,
+                         const contiguous_iterator<U> &right) noexcept {
+    return left.get_ptr() - right.get_ptr();
+}
+
+template <typename T, typename U>
+bool operator==(const contiguous_iterator<T> &left, const contiguous_iterator<U> &right) noexcept {
+    return left.get_ptr() == right.get_ptr();
+}
+
+template <typename T, typename U>
+bool operator!=(const contiguous_iterator<T> &left, const contiguous_iterator<U> &right) noexcept {
+    return left.get_ptr() != right.get_ptr();
+}
+
+template <typename T, typename U>
+bool operator<(const contiguous_iterator<T> &left, const contiguous_iterator<U> &right) noexcept {
+    return left.get_ptr() < right.get_ptr();
+}
+
+template <typename T, typename U>
+bool operator>(const contiguous_iterator<T> &left, const contiguous_iterator<U> &right) noexcept {
+    return left.get_ptr() > right.get_ptr();
+}
+
+template <typename T, typename U>
+bool operator<=(const contiguous_iterator<T> &left, const contiguous_iterator<U> &right) noexcept {
+    return left.get_ptr() <= right.get_ptr();
+}
+
+template <typename T, typename U>
+bool operator>=(const contiguous_iterator<T> &left, const contiguous_iterator<U> &right) noexcept {
+    return left.get_ptr() >= right.get_ptr();
+}
+}  // namespace containers
+
+#endif
@@ -1,8 +1,16 @@
 #ifndef CONTAINERS_LIST
 #define CONTAINERS_LIST
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "node_pool.h"
 
 namespace containers {
 template <typename T, typename Allocator = std::allocator<T>>
@@ -13,43 +21,129 @@ class list {
     using size_type = size_t;
 
    private:
-    struct node {
+    struct node_base {
+        node_base *prev_;
+        node_base *next_;
+    };
+    struct node : node_base {
         value_type value_;
-        node *prev_;
-        node *next_;
 
-        node(const_reference value, node *prev = nullptr, node *next = nullptr)
-            : value_(value), prev_(prev), next_(next) {}
+        template <typename... Args>
+        node(Args &&...args) : node_base{nullptr, nullptr}, value_(std::forward<Args>(args)...) {}
     };
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+
+    // The list is a ring closed by end_: end_.next_ is the first node and end_.prev_ the last one,
+    // an empty list points end_ at itself. end() is the iterator to end_.
     size_type size_ = 0;
-    node *head_ = nullptr;  // pointer to the first node
-    node *tail_ = nullptr;  // pointer to the next node after the last one
+    node_base end_{&end_, &end_};
+    node_allocator allocator_;
+
+    template <typename... Args>
+    node *create_node(Args &&...args);
+    void destroy_node(node_base *ptr) noexcept;
+    void steal(list &other) noexcept;
+    // links the chain first..last (both included) in front of pos
+    static void link(node_base *pos, node_base *first, node_base *last) noexcept;
+    // cuts the chain first..last (both included) out of its list
+    static void unlink(node_base *first, node_base *last) noexcept;
+    static reference value(node_base *ptr) noexcept { return static_cast<node *>(ptr)->value_; }
+    // Merges two sorted chains that end in nullptr and are linked through next_ only into `left`.
+    // On equal elements the ones of `left` come first. If comp throws, `left` still gets every
+    // node of both chains.
+    template <typename Compare>
+    static void merge_chains(node_base *&left, node_base *right, Compare &comp);
+    // appends a chain that ends in nullptr to the list, setting the prev_ links
+    void append_chain(node_base *chain) noexcept;
 
    public:
     class iterator {
-       private:
-        node *ptr_;
-
        public:
-        iterator(node *ptr) : ptr_(ptr) {}
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        iterator(node_base *ptr = nullptr) : ptr_(ptr) {}
 
-        reference operator*() const { return ptr_->value_; }
+        reference operator*() const { return static_cast<node *>(ptr_)->value_; }
+        pointer operator->() const { return &static_cast<node *>(ptr_)->value_; }
 
         iterator &operator++() {
             ptr_ = ptr_->next_;
             return *this;
         }
+        iterator operator++(int) {
+            iterator result = *this;
+            ptr_ = ptr_->next_;
+            return result;
+        }
         iterator &operator--() {
             ptr_ = ptr_->prev_;
             return *this;
         }
+        iterator operator--(int) {
+            iterator result = *this;
+            ptr_ = ptr_->prev_;
+            return result;
+        }
         bool operator==(const iterator &other) const { return ptr_ == other.ptr_; }
         bool operator!=(const iterator &other) const { return ptr_ != other.ptr_; }
-        node *get_ptr() { return ptr_; }
+        node_base *get_ptr() const { return ptr_; }
+
+       private:
+        node_base *ptr_;
+    };
+
+    class const_iterator {
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator(const node_base *ptr = nullptr) : ptr_(ptr) {}
+        const_iterator(const iterator &other) : ptr_(other.get_ptr()) {}
+
+        reference operator*() const { return static_cast<const node *>(ptr_)->value_; }
+        pointer operator->() const { return &static_cast<const node *>(ptr_)->value_; }
+
+        const_iterator &operator++() {
+            ptr_ = ptr_->next_;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator result = *this;
+            ptr_ = ptr_->next_;
+            return result;
+        }
+        const_iterator &operator--() {
+            ptr_ = ptr_->prev_;
+            return *this;
+        }
+        const_iterator operator--(int) {
+            const_iterator result = *this;
+            ptr_ = ptr_->prev_;
+            return result;
+        }
+        friend bool operator==(const const_iterator &left, const const_iterator &right) {
+            return left.ptr_ == right.ptr_;
+        }
+        friend bool operator!=(const const_iterator &left, const const_iterator &right) {
+            return left.ptr_ != right.ptr_;
+        }
+        // the list owns the node, so a list method may modify it through a const_iterator
+        node_base *get_ptr() const { return const_cast<node_base *>(ptr_); }
+
+       private:
+        const node_base *ptr_;
     };
 
     // List Functions
     list();
+    explicit list(const Allocator &allocator);
     list(size_type n);
     list(std::initializer_list<T> const &items);
     list(const list &l);
@@ -58,13 +152,21 @@ class list {
     list &operator=(std::initializer_list<T> const &items);
     ~list();
 
+    Allocator get_allocator() const { return Allocator(allocator_); }
+
     // List Element access
+    reference front();
     const_reference front() const;
+    reference back();
     const_reference back() const;
 
     // List Iterators
-    iterator begin() const;
-    iterator end() const;
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
 
     // List Capacity
     bool empty() const noexcept;
@@ -73,21 +175,40 @@ class list {
 
     // List Modifiers
     void clear();
-    iterator insert(iterator pos, const_reference value);
+    iterator insert(const_iterator pos, const_reference value);
+    iterator insert(const_iterator pos, value_type &&value);
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
     void push_back(const_reference value);
+    void push_back(value_type &&value);
+    template <typename... Args>
+    reference emplace_back(Args &&...args);
     void push_front(const_reference value);
+    void push_front(value_type &&value);
+    template <typename... Args>
+    reference emplace_front(Args &&...args);
     void pop_back();
     void pop_front();
     void reverse();
-    void erase(iterator pos);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
     void swap(list &other);
     void merge(list &other);
-    void splice(const iterator pos, list &other);
+    template <typename Compare>
+    void merge(list &other, Compare comp);
+    void splice(const_iterator pos, list &other);
+    void splice(const_iterator pos, list &other, const_iterator it);
+    void splice(const_iterator pos, list &other, const_iterator first, const_iterator last);
     void unique();
+    template <typename BinaryPredicate>
+    void unique(BinaryPredicate pred);
+    void sort();
+    template <typename Compare>
+    void sort(Compare comp);
 
     // Other
     template <typename... Args>
-    void insert_many(iterator pos, Args &&...args);
+    iterator insert_many(const_iterator pos, Args &&...args);
 
     template <typename... Args>
     void insert_many_back(Args &&...args);
@@ -102,9 +223,12 @@ class list {
 template <typename T, typename Allocator>
 containers::list<T, Allocator>::list() {}
 
+template <typename T, typename Allocator>
+containers::list<T, Allocator>::list(const Allocator &allocator) : allocator_(allocator) {}
+
 template <typename T, typename Allocator>
 containers::list<T, Allocator>::list(size_type n) {
-    for (size_type i = 0; i < n; ++i) push_back(0);
+    for (size_type i = 0; i < n; ++i) emplace_back();
 }
 
 template <typename T, typename Allocator>
@@ -113,31 +237,41 @@ containers::list<T, Allocator>::list(std::initializer_list<T> const &items) {
 }
 
 template <typename T, typename Allocator>
-containers::list<T, Allocator>::list(const list &l) {
+containers::list<T, Allocator>::list(const list &l)
+    : allocator_(std::allocator_traits<node_allocator>::select_on_container_copy_construction(
+          l.allocator_)) {
     for (auto &item : l) push_back(item);
 }
 
 template <typename T, typename Allocator>
-containers::list<T, Allocator>::list(list &&l) : size_(l.size_), head_(l.head_), tail_(l.tail_) {
-    l.head_ = nullptr;
-    l.tail_ = nullptr;
-    l.size_ = 0;
+containers::list<T, Allocator>::list(list &&l) : allocator_(l.allocator_) {
+    steal(l);
 }
 
 template <typename T, typename Allocator>
-containers::list<T, Allocator> &containers::list<T, Allocator>::operator=(std::initializer_list<T> const &items) {
+containers::list<T, Allocator> &containers::list<T, Allocator>::operator=(
+    std::initializer_list<T> const &items) {
+    clear();
     for (auto &item : items) push_back(item);
+    return *this;
 }
 
 template <typename T, typename Allocator>
 containers::list<T, Allocator> &containers::list<T, Allocator>::operator=(list &&l) {
+    if (this == &l) return *this;
     clear();
-    size_ = l.size_;
-    head_ = l.head_;
-    tail_ = l.tail_;
-    l.head_ = nullptr;
-    l.tail_ = nullptr;
-    l.size_ = 0;
+    if constexpr (!std::allocator_traits<
+                      node_allocator>::propagate_on_container_move_assignment::value) {
+        if (allocator_ != l.allocator_) {
+            // the nodes of l cannot be freed through this allocator, move the values instead
+            for (auto &item : l) push_back(std::move(item));
+            l.clear();
+            return *this;
+        }
+    } else {
+        allocator_ = std::move(l.allocator_);
+    }
+    steal(l);
     return *this;
 }
 
@@ -147,29 +281,117 @@ containers::list<T, Allocator>::~list() {
 }
 
 template <typename T, typename Allocator>
-typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::begin() const {
-    return head_;
+template <typename... Args>
+typename containers::list<T, Allocator>::node *containers::list<T, Allocator>::create_node(
+    Args &&...args) {
+    node *ptr = allocator_.allocate(1);
+    try {
+        ::new (static_cast<void *>(ptr)) node(std::forward<Args>(args)...);
+    } catch (...) {
+        allocator_.deallocate(ptr, 1);
+        throw;
+    }
+    return ptr;
+}
+
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::destroy_node(node_base *ptr) noexcept {
+    node *value_node = static_cast<node *>(ptr);
+    value_node->~node();
+    allocator_.deallocate(value_node, 1);
+}
+
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::steal(list &other) noexcept {
+    // this list must be empty, the allocators must be equal
+    if (other.size_ == 0) return;
+    link(&end_, other.end_.next_, other.end_.prev_);
+    size_ = other.size_;
+    other.end_.prev_ = other.end_.next_ = &other.end_;
+    other.size_ = 0;
 }
 
 template <typename T, typename Allocator>
-typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::end() const {
-    return tail_;
+void containers::list<T, Allocator>::link(node_base *pos, node_base *first,
+                                          node_base *last) noexcept {
+    first->prev_ = pos->prev_;
+    last->next_ = pos;
+    pos->prev_->next_ = first;
+    pos->prev_ = last;
 }
 
 template <typename T, typename Allocator>
-typename containers::list<T, Allocator>::const_reference containers::list<T, Allocator>::front() const {
+void containers::list<T, Allocator>::unlink(node_base *first, node_base *last) noexcept {
+    first->prev_->next_ = last->next_;
+    last->next_->prev_ = first->prev_;
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::begin() noexcept {
+    return end_.next_;
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::const_iterator containers::list<T, Allocator>::begin()
+    const noexcept {
+    return end_.next_;
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::const_iterator containers::list<T, Allocator>::cbegin()
+    const noexcept {
+    return end_.next_;
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::end() noexcept {
+    return &end_;
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::const_iterator containers::list<T, Allocator>::end()
+    const noexcept {
+    return &end_;
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::const_iterator containers::list<T, Allocator>::cend()
+    const noexcept {
+    return &end_;
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::reference containers::list<T, Allocator>::front() {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    return *begin();
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::const_reference containers::list<T, Allocator>::front()
+    const {
     if (empty()) {
         throw std::out_of_range("out_of_range");
     }
-    return head_->value_;
+    return *begin();
 }
 
 template <typename T, typename Allocator>
-typename containers::list<T, Allocator>::const_reference containers::list<T, Allocator>::back() const {
+typename containers::list<T, Allocator>::reference containers::list<T, Allocator>::back() {
     if (empty()) {
         throw std::out_of_range("out_of_range");
     }
-    return tail_->prev_->value_;
+    return *--end();
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::const_reference containers::list<T, Allocator>::back()
+    const {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    return *--end();
 }
 
 template <typename T, typename Allocator>
@@ -179,7 +401,7 @@ size_t containers::list<T, Allocator>::size() const {
 
 template <typename T, typename Allocator>
 bool containers::list<T, Allocator>::empty() const noexcept {
-    return head_ == nullptr;
+    return size_ == 0;
 }
 
 template <typename T, typename Allocator>
@@ -189,40 +411,50 @@ size_t containers::list<T, Allocator>::max_size() const noexcept {
 
 template <typename T, typename Allocator>
 void containers::list<T, Allocator>::clear() {
-    while (!empty()) {
-        node *tmp = head_->next_;
-        delete head_;
-        head_ = tmp;
+    node_base *curr = end_.next_;
+    while (curr != &end_) {
+        node_base *next = curr->next_;
+        destroy_node(curr);
+        curr = next;
     }
     size_ = 0;
-    head_ = nullptr;
-    tail_ = nullptr;
+    end_.prev_ = end_.next_ = &end_;
+    // every node is back in the allocator, a pool can give its blocks back
+    detail::release(allocator_);
 }
 
 template <typename T, typename Allocator>
 void containers::list<T, Allocator>::push_back(const_reference value) {
-    if (head_ == nullptr) {
-        head_ = new node(value);
-        tail_ = new node(value, head_);
-        head_->next_ = tail_;
-        ++size_;
-        return;
-    }
-    tail_->value_ = value;  // put the value in the dummy node, which now will no longer be dummy
-    tail_->next_ = new node(value, tail_);  // allocate new dummy for tail_
-    tail_ = tail_->next_;                   // tail_ -> new dummy node
-    ++size_;                                // ++size_
+    emplace(end(), value);
+}
+
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::push_back(value_type &&value) {
+    emplace(end(), std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename containers::list<T, Allocator>::reference containers::list<T, Allocator>::emplace_back(
+    Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
 }
 
 template <typename T, typename Allocator>
 void containers::list<T, Allocator>::push_front(const_reference value) {
-    if (head_ == nullptr) {
-        push_back(value);
-        return;
-    }
-    head_->prev_ = new node(value, nullptr, head_);
-    head_ = head_->prev_;
-    ++size_;
+    emplace(begin(), value);
+}
+
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::push_front(value_type &&value) {
+    emplace(begin(), std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename containers::list<T, Allocator>::reference containers::list<T, Allocator>::emplace_front(
+    Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
 }
 
 template <typename T, typename Allocator>
@@ -230,17 +462,7 @@ void containers::list<T, Allocator>::pop_back() {
     if (empty()) {
         throw std::out_of_range("out_of_range");
     }
-    node *temp = tail_;  // to delete of the end
-    if (size_ == 1) {
-        tail_ = nullptr;
-        head_ = nullptr;
-    } else {
-        tail_ = tail_->prev_;
-        tail_->value_ = tail_->prev_->value_;
-        tail_->next_ = nullptr;
-    }
-    --size_;
-    delete temp;
+    erase(end_.prev_);
 }
 
 template <typename T, typename Allocator>
@@ -248,176 +470,303 @@ void containers::list<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("out_of_range");
     }
-    node *temp = head_;
-    if (size_ == 1) {
-        tail_ = nullptr;
-        head_ = nullptr;
-    } else {
-        head_ = head_->next_;
-        head_->prev_ = nullptr;
-    }
-    --size_;
-    delete temp;
+    erase(end_.next_);
 }
 
 template <typename T, typename Allocator>
 void containers::list<T, Allocator>::reverse() {
-    node *curr = head_;
-    node *prev = nullptr;
-    node *next = nullptr;
-    for (size_type i = 0; i < size_; i++) {
-        next = curr->next_;  // save next element
-        curr->prev_ = next;  // now it points to the next element
-        curr->next_ = prev;  // now it points to the prev element
-        prev = curr;         // so that in the next iteration it points to the current element
-        curr = next;         // moving on to the next element
-    }
-    tail_ = head_;
-    head_ = prev;
+    // swapping the links of every node, end_ included, turns the ring around
+    node_base *curr = &end_;
+    do {
+        std::swap(curr->prev_, curr->next_);
+        curr = curr->prev_;  // the old next
+    } while (curr != &end_);
 }
 
 template <typename T, typename Allocator>
-typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::insert(iterator pos,
-                                                                           const_reference value) {
-    if (begin() == pos) {
-        push_front(value);
-        return begin();
-    }
-    if (end() == pos) {
-        push_back(value);
-        return end();
-    }
-    node *curr = head_;
-    node *temp = new node(value);
-    iterator iter_begin = begin();
-    while (iter_begin != pos) {
-        curr = curr->next_;
-        ++iter_begin;
-    }
-    temp->prev_ = curr->prev_;
-    temp->next_ = curr;
-    curr->prev_ = temp;
-    temp->prev_->next_ = temp;
+typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::insert(
+    const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::insert(
+    const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::emplace(
+    const_iterator pos, Args &&...args) {
+    // the value is built in its node, end_ holds no value to copy through
+    node *temp = create_node(std::forward<Args>(args)...);
+    link(pos.get_ptr(), temp, temp);
     ++size_;
-    return --iter_begin;
+    return temp;
 }
 
 template <typename T, typename Allocator>
-void containers::list<T, Allocator>::erase(iterator pos) {
-    if (begin() == pos) {
-        pop_front();
-        return;
-    }
-    if (end() == pos) {
-        pop_back();
-        return;
-    }
-    node *curr = head_;
-    iterator iter_begin = begin();
-    while (iter_begin != pos) {
-        curr = curr->next_;
-        ++iter_begin;
+typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::erase(
+    const_iterator pos) {
+    if (pos == end()) {
+        throw std::out_of_range("out_of_range");
     }
-    curr->prev_->next_ = curr->next_;
-    curr->next_->prev_ = curr->prev_;
+    node_base *curr = pos.get_ptr();
+    node_base *next = curr->next_;
+    unlink(curr, curr);
     --size_;
-    delete curr;
+    destroy_node(curr);
+    return next;
+}
+
+template <typename T, typename Allocator>
+typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::erase(
+    const_iterator first, const_iterator last) {
+    node_base *curr = first.get_ptr();
+    node_base *stop = last.get_ptr();
+    if (curr == stop) return stop;
+    unlink(curr, stop->prev_);
+    while (curr != stop) {
+        node_base *next = curr->next_;
+        destroy_node(curr);
+        --size_;
+        curr = next;
+    }
+    return stop;
 }
 
 template <typename T, typename Allocator>
 void containers::list<T, Allocator>::swap(list &other) {
-    std::swap(size_, other.size_);
-    std::swap(head_, other.head_);
-    std::swap(tail_, other.tail_);
+    if (this == &other) return;
+    // each end_ stays in its list, the rings of nodes change places
+    node_base *first = end_.next_;
+    node_base *last = end_.prev_;
+    size_type count = size_;
+    end_.prev_ = end_.next_ = &end_;
+    size_ = 0;
+    steal(other);
+    if (count) link(&other.end_, first, last);
+    other.size_ = count;
+    std::swap(allocator_, other.allocator_);
 }
 
 template <typename T, typename Allocator>
 void containers::list<T, Allocator>::merge(list &other) {
-    if (other.size_ == 0) return;
-    if (size_ == 0) {
-        *this = std::move(other);
-    } else {
-        tail_->prev_->next_ = other.head_;
-        other.head_->prev_ = tail_;
-
-        tail_ = other.tail_;
-        size_ += other.size_;
-        other.head_ = nullptr;
-        other.tail_ = nullptr;
-        other.size_ = 0;
+    merge(other, std::less<>());
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void containers::list<T, Allocator>::merge(list &other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    // both lists are sorted, so the insertion point only moves forward
+    node_base *pos = end_.next_;
+    node_base *curr = other.end_.next_;
+    if (allocator_ != other.allocator_) {
+        // nodes cannot change owner between allocators that do not share memory
+        for (; curr != &other.end_; curr = curr->next_) {
+            while (pos != &end_ && !comp(value(curr), value(pos))) pos = pos->next_;
+            insert(pos, std::move(value(curr)));
+        }
+        other.clear();
+        return;
+    }
+    while (curr != &other.end_) {
+        while (pos != &end_ && !comp(value(curr), value(pos))) pos = pos->next_;
+        if (pos == &end_) {
+            // the rest of other is not less than anything left here
+            node_base *last = other.end_.prev_;
+            unlink(curr, last);
+            link(&end_, curr, last);
+            size_ += other.size_;
+            other.size_ = 0;
+            break;
+        }
+        node_base *next = curr->next_;
+        unlink(curr, curr);
+        link(pos, curr, curr);
+        ++size_;
+        --other.size_;
+        curr = next;
     }
 }
 
 template <typename T, typename Allocator>
-void containers::list<T, Allocator>::splice(const iterator pos, list &other) {
-    if (other.size_ == 0) return;
-    node *curr = head_;
-    iterator iter_begin = begin();
-    while (iter_begin != pos) {
-        curr = curr->next_;
-        ++iter_begin;
+template <typename Compare>
+void containers::list<T, Allocator>::merge_chains(node_base *&left, node_base *right,
+                                                  Compare &comp) {
+    node_base head{nullptr, nullptr};
+    node_base *tail = &head;
+    try {
+        while (left && right) {
+            if (comp(value(right), value(left))) {
+                tail->next_ = right;
+                right = right->next_;
+            } else {
+                tail->next_ = left;
+                left = left->next_;
+            }
+            tail = tail->next_;
+        }
+    } catch (...) {
+        tail->next_ = left;
+        while (tail->next_) tail = tail->next_;
+        tail->next_ = right;
+        left = head.next_;
+        throw;
     }
-    if (curr == head_) {
-        other.tail_->next_ = head_;
-        head_->prev_ = other.tail_->prev_;
-        head_ = other.head_;
-    } else {
-        curr->prev_->next_ = other.head_;
-        other.head_->prev_ = curr->prev_;
+    tail->next_ = left ? left : right;
+    left = head.next_;
+}
+
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::append_chain(node_base *chain) noexcept {
+    while (chain) {
+        node_base *next = chain->next_;
+        link(&end_, chain, chain);
+        chain = next;
     }
-    other.tail_->prev_->next_ = curr;
-    curr->prev_ = other.tail_->prev_;
+}
 
-    size_ += other.size_;
-    other.size_ = 0;
-    other.head_ = nullptr;
-    other.tail_ = nullptr;
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::splice(const_iterator pos, list &other) {
+    splice(pos, other, other.begin(), other.end());
 }
 
 template <typename T, typename Allocator>
-void containers::list<T, Allocator>::unique() {
-    if (empty() || head_->next_ == nullptr) return;
-    for (iterator it_last = begin(); it_last != end();) {
-        iterator it_next = it_last;
-        ++it_next;
-        if (it_next == end()) {
-            break;
+void containers::list<T, Allocator>::splice(const_iterator pos, list &other, const_iterator it) {
+    const_iterator last = it;
+    ++last;
+    if (pos == it || pos == last) return;  // already in place
+    splice(pos, other, it, last);
+}
+
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::splice(const_iterator pos, list &other, const_iterator first,
+                                            const_iterator last) {
+    if (first == last) return;
+    if (allocator_ != other.allocator_) {
+        // nodes cannot change owner between allocators that do not share memory
+        for (const_iterator it = first; it != last; ++it) {
+            insert(pos, std::move(value(it.get_ptr())));
+        }
+        other.erase(first, last);
+        return;
+    }
+    node_base *head = first.get_ptr();
+    node_base *tail = last.get_ptr()->prev_;
+    if (&other != this) {
+        // relinking is O(1), only a part of other needs a walk to count its elements
+        size_type count = other.size_;
+        if (first != other.begin() || last != other.end()) {
+            count = 1;
+            for (node_base *curr = head; curr != tail; curr = curr->next_) ++count;
         }
-        if (*it_last == *it_next) {
-            erase(it_next);
+        other.size_ -= count;
+        size_ += count;
+    }
+    unlink(head, tail);
+    link(pos.get_ptr(), head, tail);
+}
+
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::unique() {
+    unique(std::equal_to<>());
+}
+
+template <typename T, typename Allocator>
+template <typename BinaryPredicate>
+void containers::list<T, Allocator>::unique(BinaryPredicate pred) {
+    if (size_ < 2) return;
+    // every element is compared with the last one kept, duplicates are unlinked on the spot
+    node_base *last = end_.next_;
+    for (node_base *curr = last->next_; curr != &end_;) {
+        node_base *next = curr->next_;
+        if (pred(value(last), value(curr))) {
+            unlink(curr, curr);
+            destroy_node(curr);
+            --size_;
         } else {
-            ++it_last;
+            last = curr;
+        }
+        curr = next;
+    }
+}
+
+template <typename T, typename Allocator>
+void containers::list<T, Allocator>::sort() {
+    sort(std::less<>());
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void containers::list<T, Allocator>::sort(Compare comp) {
+    if (size_ < 2) return;
+    // Bottom-up merge sort on the nodes: runs[i] holds a sorted chain of 2^i nodes, every node
+    // taken from the list is carried through the occupied slots like a binary counter. Earlier
+    // nodes always end up on the left of a merge, which keeps the sort stable.
+    node_base *runs[std::numeric_limits<size_type>::digits] = {};
+    node_base *run = nullptr;
+    node_base *sorted = nullptr;
+    node_base *curr = end_.next_;
+    end_.prev_->next_ = nullptr;
+    end_.prev_ = end_.next_ = &end_;
+    try {
+        while (curr) {
+            run = curr;
+            curr = curr->next_;
+            run->next_ = nullptr;
+            size_type i = 0;
+            for (; runs[i]; ++i) {
+                merge_chains(runs[i], std::exchange(run, nullptr), comp);
+                run = std::exchange(runs[i], nullptr);
+            }
+            runs[i] = std::exchange(run, nullptr);
+        }
+        for (node_base *&earlier : runs) {
+            if (!earlier) continue;
+            merge_chains(earlier, std::exchange(sorted, nullptr), comp);
+            sorted = std::exchange(earlier, nullptr);
         }
+    } catch (...) {
+        // comp threw: keep every node, in whatever order the chains are in
+        for (node_base *chain : runs) append_chain(chain);
+        append_chain(run);
+        append_chain(sorted);
+        append_chain(curr);
+        throw;
     }
+    append_chain(sorted);
 }
 
 template <typename T, typename Allocator>
 template <typename... Args>
-void containers::list<T, Allocator>::insert_many(iterator pos, Args &&...args) {
-    iterator first_inserted = pos;
-    (..., (first_inserted = insert(first_inserted, std::forward<Args>(args))));
+typename containers::list<T, Allocator>::iterator containers::list<T, Allocator>::insert_many(
+    const_iterator pos, Args &&...args) {
+    // the node in front of pos stays in place, the first inserted element follows it
+    iterator before = pos.get_ptr()->prev_;
+    (emplace(pos, std::forward<Args>(args)), ...);
+    return ++before;
 }
 
 template <typename T, typename Allocator>
 template <typename... Args>
 void containers::list<T, Allocator>::insert_many_back(Args &&...args) {
-    (push_back(args), ...);
+    insert_many(end(), std::forward<Args>(args)...);
 }
 
 template <typename T, typename Allocator>
 template <typename... Args>
 void containers::list<T, Allocator>::insert_many_front(Args &&...args) {
-    auto iter = begin();
-    ((insert(iter, std::forward<Args>(args)), --iter), ...);
+    insert_many(begin(), std::forward<Args>(args)...);
 }
 
 template <typename T, typename Allocator>
 void containers::list<T, Allocator>::print() {
-    node *curr = head_;
-    for (size_type i = 0; i < size_; ++i) {
+    for (node_base *curr = end_.next_; curr != &end_; curr = curr->next_) {
         std::cout << curr << " | prev: " << curr->prev_ << " | next: " << curr->next_
-                  << " | value: " << curr->value_ << std::endl;
-        curr = curr->next_;
+                  << " | value: " << static_cast<node *>(curr)->value_ << std::endl;
     }
 }
 
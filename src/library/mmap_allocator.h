@@ -0,0 +1,141 @@
+#ifndef CONTAINERS_MMAP_ALLOCATOR
+#define CONTAINERS_MMAP_ALLOCATOR
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+namespace containers {
+// Allocator for very large buffers. Blocks of at least Threshold bytes are anonymous mappings
+// that grow and shrink with mremap, so a vector of trivially relocatable elements changes
+// capacity without copying. With HugePages the mappings are advised to use transparent huge
+// pages. Smaller blocks come from operator new.
+template <typename T, bool HugePages = false, size_t Threshold = (size_t(1) << 20)>
+class mmap_allocator {
+   public:
+    using value_type = T;
+    using size_type = size_t;
+
+    template <typename U>
+    struct rebind {
+        using other = mmap_allocator<U, HugePages, Threshold>;
+    };
+
+    mmap_allocator() noexcept = default;
+    template <typename U>
+    mmap_allocator(const mmap_allocator<U, HugePages, Threshold> &) noexcept {}
+
+    T *allocate(size_type n);
+    void deallocate(T *p, size_type n) noexcept;
+    T *reallocate(T *p, size_type old_n, size_type new_n);
+
+   private:
+    static bool is_mapped(size_type n) noexcept { return n * sizeof(T) >= Threshold; }
+    // operator new only aligns to __STDCPP_DEFAULT_NEW_ALIGNMENT__ unless asked for more
+    static constexpr bool over_aligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    static size_t page_size() noexcept;
+    static size_t mapping_size(size_type n) noexcept;
+    static void *map(size_t bytes);
+    static void advise(void *p, size_t bytes) noexcept;
+};
+
+template <typename T, bool HugePages, size_t Threshold, typename U>
+bool operator==(const mmap_allocator<T, HugePages, Threshold> &,
+                const mmap_allocator<U, HugePages, Threshold> &) {
+    return true;
+}
+
+template <typename T, bool HugePages, size_t Threshold, typename U>
+bool operator!=(const mmap_allocator<T, HugePages, Threshold> &,
+                const mmap_allocator<U, HugePages, Threshold> &) {
+    return false;
+}
+}  // namespace containers
+
+template <typename T, bool HugePages, size_t Threshold>
+T *containers::mmap_allocator<T, HugePages, Threshold>::allocate(size_type n) {
+    if (!is_mapped(n)) {
+        if constexpr (over_aligned) {
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        } else {
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+        }
+    }
+    return static_cast<T *>(map(mapping_size(n)));
+}
+
+template <typename T, bool HugePages, size_t Threshold>
+void containers::mmap_allocator<T, HugePages, Threshold>::deallocate(T *p,
+                                                                    size_type n) noexcept {
+    if (!p) return;
+    if (!is_mapped(n)) {
+        if constexpr (over_aligned) {
+            ::operator delete(p, std::align_val_t(alignof(T)));
+        } else {
+            ::operator delete(p);
+        }
+    } else {
+        munmap(p, mapping_size(n));
+    }
+}
+
+template <typename T, bool HugePages, size_t Threshold>
+T *containers::mmap_allocator<T, HugePages, Threshold>::reallocate(T *p, size_type old_n,
+                                                                  size_type new_n) {
+    // keeps the bytes of the first min(old_n, new_n) elements, the old block is released
+    if (!p) return allocate(new_n);
+#ifdef MREMAP_MAYMOVE
+    if (is_mapped(old_n) && is_mapped(new_n)) {
+        size_t new_bytes = mapping_size(new_n);
+        void *moved = mremap(p, mapping_size(old_n), new_bytes, MREMAP_MAYMOVE);
+        if (moved == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        advise(moved, new_bytes);
+        return static_cast<T *>(moved);
+    }
+#endif
+    T *fresh = allocate(new_n);
+    size_type kept = old_n < new_n ? old_n : new_n;
+    std::memcpy(static_cast<void *>(fresh), static_cast<const void *>(p), kept * sizeof(T));
+    deallocate(p, old_n);
+    return fresh;
+}
+
+template <typename T, bool HugePages, size_t Threshold>
+size_t containers::mmap_allocator<T, HugePages, Threshold>::page_size() noexcept {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+template <typename T, bool HugePages, size_t Threshold>
+size_t containers::mmap_allocator<T, HugePages, Threshold>::mapping_size(size_type n) noexcept {
+    size_t bytes = n * sizeof(T);
+    return (bytes + page_size() - 1) / page_size() * page_size();
+}
+
+template <typename T, bool HugePages, size_t Threshold>
+void *containers::mmap_allocator<T, HugePages, Threshold>::map(size_t bytes) {
+    void *p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    advise(p, bytes);
+    return p;
+}
+
+template <typename T, bool HugePages, size_t Threshold>
+void containers::mmap_allocator<T, HugePages, Threshold>::advise(void *p, size_t bytes) noexcept {
+#ifdef MADV_HUGEPAGE
+    if constexpr (HugePages) {
+        madvise(p, bytes, MADV_HUGEPAGE);  // only a hint, failures are ignored
+    }
+#endif
+    (void)p;
+    (void)bytes;
+}
+
+#endif
@@ -0,0 +1,277 @@
+#ifndef CONTAINERS_MPMC_QUEUE
+#define CONTAINERS_MPMC_QUEUE
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "backoff.h"
+#include "cache_line.h"
+
+namespace containers {
+// Bounded FIFO for any number of producer and consumer threads, after Dmitry Vyukov's bounded
+// MPMC queue. Every cell carries a sequence number that says whose turn it is: a producer may fill
+// the cell at position p when its sequence is p, a consumer may empty it when the sequence is
+// p + 1, and emptying sets it to p + capacity for the producer of the next lap. Claiming a position
+// is one compare-and-swap on the shared enqueue or dequeue counter, the cells themselves are
+// handed over with plain release stores, so producers and consumers never wait for each other
+// unless the queue is full or empty.
+//
+// Elements must be nothrow move constructible: a claimed cell cannot be given back, so nothing
+// may throw between claiming and publishing it.
+template <typename T, typename Allocator = std::allocator<T>>
+class mpmc_queue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "mpmc_queue elements must be nothrow move constructible");
+
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+   private:
+    struct cell {
+        std::atomic<size_type> sequence_;
+        alignas(T) unsigned char storage_[sizeof(T)];
+
+        T *value() noexcept { return reinterpret_cast<T *>(storage_); }
+    };
+    using cell_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<cell>;
+
+    // written by nobody after construction
+    struct alignas(cache_line_size) shared_state {
+        cell *cells_;
+        size_type mask_;
+        cell_allocator allocator_;
+    };
+    struct alignas(cache_line_size) position {
+        std::atomic<size_type> value_{0};
+    };
+
+    shared_state ring_;
+    position enqueue_;
+    position dequeue_;
+
+    cell &cell_at(size_type pos) const noexcept { return ring_.cells_[pos & ring_.mask_]; }
+    // signed distance between a cell sequence and the one expected, wrapping counters included
+    static std::ptrdiff_t lag(size_type sequence, size_type expected) noexcept {
+        return static_cast<std::ptrdiff_t>(sequence - expected);
+    }
+    // Claims up to n consecutive positions whose cells are ready for `offset` (0 to fill, 1 to
+    // empty). Returns the first claimed position and sets n to the count, zero when none is ready.
+    size_type claim(position &counter, size_type offset, size_type &n) noexcept;
+
+   public:
+    // Mpmc queue Member functions
+    explicit mpmc_queue(size_type capacity);
+    mpmc_queue(const mpmc_queue &) = delete;
+    mpmc_queue &operator=(const mpmc_queue &) = delete;
+    ~mpmc_queue();
+
+    // Mpmc queue Capacity
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+
+    // Mpmc queue Modifiers
+    template <typename... Args>
+    bool try_emplace(Args &&...args);
+    bool try_push(const_reference value);
+    bool try_push(value_type &&value);
+    // Moves up to n elements out of [first, first + n) and returns how many fit.
+    template <typename ForwardIt>
+    size_type try_push_n(ForwardIt first, size_type n);
+    bool try_pop(reference value);
+    // Moves up to n elements to out and returns how many there were. If writing to out throws,
+    // the elements taken from the queue and not written yet are destroyed.
+    template <typename OutputIt>
+    size_type try_pop_n(OutputIt out, size_type n);
+
+    // Spin, then yield the thread, until the operation succeeds.
+    void push(const_reference value);
+    void push(value_type &&value);
+    void pop(reference value);
+};
+}  // namespace containers
+
+template <typename T, typename Allocator>
+containers::mpmc_queue<T, Allocator>::mpmc_queue(size_type capacity) {
+    if (capacity < 2 || capacity > (size_type(1) << (std::numeric_limits<size_type>::digits - 2))) {
+        throw std::length_error("length_error");
+    }
+    size_type rounded = 2;
+    while (rounded < capacity) rounded *= 2;
+    ring_.cells_ = ring_.allocator_.allocate(rounded);
+    ring_.mask_ = rounded - 1;
+    for (size_type i = 0; i < rounded; ++i) {
+        ::new (static_cast<void *>(&ring_.cells_[i].sequence_)) std::atomic<size_type>(i);
+    }
+}
+
+template <typename T, typename Allocator>
+containers::mpmc_queue<T, Allocator>::~mpmc_queue() {
+    size_type pos = dequeue_.value_.load(std::memory_order_relaxed);
+    size_type end = enqueue_.value_.load(std::memory_order_relaxed);
+    for (; pos != end; ++pos) cell_at(pos).value()->~T();
+    ring_.allocator_.deallocate(ring_.cells_, ring_.mask_ + 1);
+}
+
+template <typename T, typename Allocator>
+bool containers::mpmc_queue<T, Allocator>::empty() const noexcept {
+    return size() == 0;
+}
+
+template <typename T, typename Allocator>
+size_t containers::mpmc_queue<T, Allocator>::size() const noexcept {
+    // a snapshot: both counters move while they are read
+    size_type head = dequeue_.value_.load(std::memory_order_acquire);
+    size_type tail = enqueue_.value_.load(std::memory_order_acquire);
+    std::ptrdiff_t count = lag(tail, head);
+    if (count < 0) return 0;
+    return std::min(static_cast<size_type>(count), capacity());
+}
+
+template <typename T, typename Allocator>
+size_t containers::mpmc_queue<T, Allocator>::capacity() const noexcept {
+    return ring_.mask_ + 1;
+}
+
+template <typename T, typename Allocator>
+size_t containers::mpmc_queue<T, Allocator>::claim(position &counter, size_type offset,
+                                                   size_type &n) noexcept {
+    size_type pos = counter.value_.load(std::memory_order_relaxed);
+    for (;;) {
+        // A cell seen ready stays ready until somebody claims its position, and nobody can while
+        // the counter still holds pos, so counting before the CAS is safe.
+        std::ptrdiff_t first = lag(cell_at(pos).sequence_.load(std::memory_order_acquire),
+                                   pos + offset);
+        if (first < 0) {
+            n = 0;  // full or empty
+            return pos;
+        }
+        if (first > 0) {
+            // another thread claimed pos since the counter was read
+            pos = counter.value_.load(std::memory_order_relaxed);
+            continue;
+        }
+        size_type ready = 1;
+        while (ready < n && cell_at(pos + ready).sequence_.load(std::memory_order_acquire) ==
+                                pos + ready + offset) {
+            ++ready;
+        }
+        if (counter.value_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+            n = ready;
+            return pos;
+        }
+    }
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+bool containers::mpmc_queue<T, Allocator>::try_emplace(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args &&...>) {
+        size_type n = 1;
+        size_type pos = claim(enqueue_, 0, n);
+        if (n == 0) return false;
+        cell &target = cell_at(pos);
+        ::new (static_cast<void *>(target.value())) T(std::forward<Args>(args)...);
+        target.sequence_.store(pos + 1, std::memory_order_release);
+        return true;
+    } else {
+        // build the element before a cell is claimed, the move into the cell cannot throw
+        return try_push(T(std::forward<Args>(args)...));
+    }
+}
+
+template <typename T, typename Allocator>
+bool containers::mpmc_queue<T, Allocator>::try_push(const_reference value) {
+    return try_emplace(value);
+}
+
+template <typename T, typename Allocator>
+bool containers::mpmc_queue<T, Allocator>::try_push(value_type &&value) {
+    return try_emplace(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename ForwardIt>
+size_t containers::mpmc_queue<T, Allocator>::try_push_n(ForwardIt first, size_type n) {
+    static_assert(std::is_nothrow_constructible_v<T, decltype(std::move(*first))>,
+                  "try_push_n moves the elements and the move must not throw");
+    if (n == 0) return 0;
+    size_type pos = claim(enqueue_, 0, n);
+    for (size_type i = 0; i < n; ++i, ++first) {
+        cell &target = cell_at(pos + i);
+        ::new (static_cast<void *>(target.value())) T(std::move(*first));
+        target.sequence_.store(pos + i + 1, std::memory_order_release);
+    }
+    return n;
+}
+
+template <typename T, typename Allocator>
+bool containers::mpmc_queue<T, Allocator>::try_pop(reference value) {
+    size_type n = 1;
+    size_type pos = claim(dequeue_, 1, n);
+    if (n == 0) return false;
+    cell &source = cell_at(pos);
+    // the cell goes back to the producers before the assignment, which may throw
+    T item(std::move(*source.value()));
+    source.value()->~T();
+    source.sequence_.store(pos + ring_.mask_ + 1, std::memory_order_release);
+    value = std::move(item);
+    return true;
+}
+
+template <typename T, typename Allocator>
+template <typename OutputIt>
+size_t containers::mpmc_queue<T, Allocator>::try_pop_n(OutputIt out, size_type n) {
+    if (n == 0) return 0;
+    size_type pos = claim(dequeue_, 1, n);
+    size_type i = 0;
+    try {
+        for (; i < n; ++out) {
+            cell &source = cell_at(pos + i);
+            // as in try_pop, the cell goes back to the producers before the assignment
+            T item(std::move(*source.value()));
+            source.value()->~T();
+            source.sequence_.store(pos + i + ring_.mask_ + 1, std::memory_order_release);
+            ++i;
+            *out = std::move(item);
+        }
+    } catch (...) {
+        // the claimed cells not reached yet must go back too, or producers wait on them forever
+        for (; i < n; ++i) {
+            cell &source = cell_at(pos + i);
+            source.value()->~T();
+            source.sequence_.store(pos + i + ring_.mask_ + 1, std::memory_order_release);
+        }
+        throw;
+    }
+    return n;
+}
+
+template <typename T, typename Allocator>
+void containers::mpmc_queue<T, Allocator>::push(const_reference value) {
+    detail::backoff wait;
+    while (!try_emplace(value)) wait.pause();
+}
+
+template <typename T, typename Allocator>
+void containers::mpmc_queue<T, Allocator>::push(value_type &&value) {
+    detail::backoff wait;
+    // nothing is moved out of value until a cell is claimed
+    while (!try_emplace(std::move(value))) wait.pause();
+}
+
+template <typename T, typename Allocator>
+void containers::mpmc_queue<T, Allocator>::pop(reference value) {
+    detail::backoff wait;
+    while (!try_pop(value)) wait.pause();
+}
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef CONTAINERS_NODE_POOL
+#define CONTAINERS_NODE_POOL
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace containers {
+// Slab of equally sized slots for node based containers. Slots are carved from blocks of
+// `slots_per_block` slots, freed slots go to a free list and are handed out again before a new
+// block is taken. The slot size is fixed by the first allocation. A pool is not thread-safe.
+class node_pool {
+   public:
+    explicit node_pool(size_t slots_per_block = 256) noexcept
+        : slots_per_block_(slots_per_block ? slots_per_block : 1) {}
+    node_pool(const node_pool &) = delete;
+    node_pool &operator=(const node_pool &) = delete;
+    ~node_pool();
+
+    // True when the pool serves objects of this size and alignment, the first call sets the size.
+    bool accepts(size_t size, size_t align) noexcept;
+    void *allocate();
+    void deallocate(void *p) noexcept;
+
+    // Returns every block to the system when no slot is in use, otherwise does nothing.
+    void release() noexcept;
+
+    size_t in_use() const noexcept { return in_use_; }
+    size_t block_count() const noexcept { return block_count_; }
+
+   private:
+    // blocks are chained through their first slot
+    struct slot {
+        slot *next;
+    };
+
+    void free_blocks() noexcept;
+
+    size_t slots_per_block_;
+    size_t slot_size_ = 0;
+    size_t in_use_ = 0;
+    size_t block_count_ = 0;
+    slot *blocks_ = nullptr;
+    slot *free_ = nullptr;
+    char *cursor_ = nullptr;  // next never used slot of the newest block
+    char *block_end_ = nullptr;
+};
+
+// Allocator that takes single objects from a node_pool and anything else from operator new.
+// Containers rebind it to their node type, so list<T, pool_allocator<T>> allocates its nodes from
+// the pool. A default constructed allocator creates a private pool on first use; pass a pool to
+// share it between containers that live on the same thread. Copying a container gives the copy a
+// private pool of its own.
+template <typename T>
+class pool_allocator {
+   public:
+    using value_type = T;
+    using size_type = size_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <typename U>
+    struct rebind {
+        using other = pool_allocator<U>;
+    };
+
+    pool_allocator() noexcept = default;
+    // The pool must outlive every allocator and container that uses it.
+    explicit pool_allocator(node_pool &pool) noexcept
+        : pool_(std::shared_ptr<node_pool>(), &pool) {}
+    template <typename U>
+    pool_allocator(const pool_allocator<U> &other) noexcept : pool_(other.pool_) {}
+
+    T *allocate(size_type n);
+    void deallocate(T *p, size_type n) noexcept;
+
+    // Gives the blocks of the pool back to the system once none of its slots is in use.
+    void release() noexcept {
+        if (pool_) pool_->release();
+    }
+
+    pool_allocator select_on_container_copy_construction() const noexcept {
+        return pool_allocator();
+    }
+
+    const node_pool *pool() const noexcept { return pool_.get(); }
+
+   private:
+    template <typename U>
+    friend class pool_allocator;
+
+    bool pooled(size_type n) noexcept {
+        if (n != 1) return false;
+        if (!pool_) pool_ = std::make_shared<node_pool>();
+        return pool_->accepts(sizeof(T), alignof(T));
+    }
+
+    std::shared_ptr<node_pool> pool_;
+};
+
+template <typename T, typename U>
+bool operator==(const pool_allocator<T> &left, const pool_allocator<U> &right) noexcept {
+    return left.pool() == right.pool();
+}
+
+template <typename T, typename U>
+bool operator!=(const pool_allocator<T> &left, const pool_allocator<U> &right) noexcept {
+    return left.pool() != right.pool();
+}
+
+namespace detail {
+// Allocators may provide `void release()` that frees cached memory. Containers call it once they
+// hold no elements.
+template <typename Allocator, typename = void>
+struct has_release : std::false_type {};
+
+template <typename Allocator>
+struct has_release<Allocator, std::void_t<decltype(std::declval<Allocator &>().release())>>
+    : std::true_type {};
+
+template <typename Allocator>
+void release(Allocator &allocator) noexcept {
+    if constexpr (has_release<Allocator>::value) {
+        allocator.release();
+    } else {
+        (void)allocator;
+    }
+}
+}  // namespace detail
+}  // namespace containers
+
+inline containers::node_pool::~node_pool() { free_blocks(); }
+
+inline void containers::node_pool::free_blocks() noexcept {
+    while (blocks_) {
+        slot *next = blocks_->next;
+        ::operator delete(blocks_);
+        blocks_ = next;
+    }
+    free_ = nullptr;
+    cursor_ = nullptr;
+    block_end_ = nullptr;
+    block_count_ = 0;
+}
+
+inline bool containers::node_pool::accepts(size_t size, size_t align) noexcept {
+    if (align > alignof(std::max_align_t)) return false;
+    if (slot_size_ == 0) {
+        // slots stay aligned for the type because blocks come from operator new
+        size_t step = align > alignof(slot) ? align : alignof(slot);
+        size = size > sizeof(slot) ? size : sizeof(slot);
+        slot_size_ = (size + step - 1) / step * step;
+        return true;
+    }
+    return size <= slot_size_ && slot_size_ % align == 0;
+}
+
+inline void *containers::node_pool::allocate() {
+    ++in_use_;
+    if (free_) {
+        slot *result = free_;
+        free_ = free_->next;
+        return result;
+    }
+    if (cursor_ == block_end_) {
+        // the first slot of a block links the blocks together, the rest are handed out
+        size_t bytes = slot_size_ * (slots_per_block_ + 1);
+        slot *block;
+        try {
+            block = static_cast<slot *>(::operator new(bytes));
+        } catch (...) {
+            --in_use_;
+            throw;
+        }
+        block->next = blocks_;
+        blocks_ = block;
+        ++block_count_;
+        cursor_ = reinterpret_cast<char *>(block) + slot_size_;
+        block_end_ = reinterpret_cast<char *>(block) + bytes;
+    }
+    void *result = cursor_;
+    cursor_ += slot_size_;
+    return result;
+}
+
+inline void containers::node_pool::deallocate(void *p) noexcept {
+    slot *freed = static_cast<slot *>(p);
+    freed->next = free_;
+    free_ = freed;
+    --in_use_;
+}
+
+inline void containers::node_pool::release() noexcept {
+    if (in_use_ == 0) free_blocks();
+}
+
+template <typename T>
+T *containers::pool_allocator<T>::allocate(size_type n) {
+    if (pooled(n)) return static_cast<T *>(pool_->allocate());
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+}
+
+template <typename T>
+void containers::pool_allocator<T>::deallocate(T *p, size_type n) noexcept {
+    if (!p) return;
+    if (n == 1 && pool_ && pool_->accepts(sizeof(T), alignof(T))) {
+        pool_->deallocate(p);
+    } else {
+        ::operator delete(p);
+    }
+}
+
+#endif
@@ -0,0 +1,298 @@
+#ifndef CONTAINERS_PARALLEL
+#define CONTAINERS_PARALLEL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "cache_line.h"
+#include "vector.h"
+
+// Data-parallel algorithms over contiguous containers (array, vector, small_vector). The range is
+// cut into chunks whose boundaries fall on cache lines, so two threads never write the same line,
+// and the chunks are run on a reusable thread pool.
+namespace containers {
+namespace parallel {
+using containers::cache_line_size;
+
+// Fixed set of worker threads. run() hands out task indices to the workers and to the calling
+// thread and returns when all tasks are done, rethrowing the first exception a task threw.
+class thread_pool {
+   public:
+    // `threads` counts the calling thread, so a pool of one runs everything on the caller.
+    explicit thread_pool(size_t threads = std::thread::hardware_concurrency());
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+    ~thread_pool();
+
+    size_t size() const noexcept { return workers_.size() + 1; }
+
+    // Calls task(i) for every i in [0, tasks). A task that runs on this pool and calls run() again
+    // gets its tasks executed serially on its own thread.
+    template <typename Task>
+    void run(size_t tasks, Task &&task);
+
+   private:
+    void work();
+    void execute();
+    // tells the workers to exit and joins them
+    void shut_down() noexcept;
+
+    vector<std::thread> workers_;
+    std::mutex run_mutex_;  // one run() at a time
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    size_t generation_ = 0;
+    size_t active_ = 0;
+    bool stop_ = false;
+
+    void (*invoke_)(void *, size_t) = nullptr;
+    void *job_ = nullptr;
+    size_t tasks_ = 0;
+    std::atomic<size_t> next_{0};
+    std::exception_ptr error_;
+
+    static inline thread_local const thread_pool *current_ = nullptr;
+};
+
+// Pool shared by the algorithms when none is passed, sized to the hardware.
+inline thread_pool &default_pool() {
+    static thread_pool pool;
+    return pool;
+}
+
+namespace detail {
+// Splits n elements starting at `data` into `count` chunks. Chunk 0 ends at the first cache line
+// boundary after `step` elements and every later chunk starts on a boundary.
+struct partition {
+    size_t n;
+    size_t lead;
+    size_t step;
+    size_t count;
+
+    size_t begin(size_t chunk) const noexcept {
+        return chunk == 0 ? 0 : std::min(n, lead + chunk * step);
+    }
+    size_t end(size_t chunk) const noexcept { return std::min(n, lead + (chunk + 1) * step); }
+};
+
+template <typename T>
+partition make_partition(const T *data, size_t n, size_t threads) {
+    constexpr size_t line = sizeof(T) < cache_line_size && cache_line_size % sizeof(T) == 0
+                                ? cache_line_size / sizeof(T)
+                                : 1;
+    constexpr size_t min_step = line > (16384 / sizeof(T)) ? line : 16384 / sizeof(T);
+    size_t lead = 0;
+    size_t misalign = reinterpret_cast<uintptr_t>(data) % cache_line_size;
+    if (line > 1 && misalign % sizeof(T) == 0) {
+        lead = (cache_line_size - misalign) % cache_line_size / sizeof(T);
+    }
+    // a few chunks per thread keep the threads busy when chunks take unequal time
+    size_t step = (n + threads * 4 - 1) / (threads * 4);
+    step = std::max(step, min_step);
+    step = (step + line - 1) / line * line;
+    size_t count = n <= lead + step ? 1 : 1 + (n - lead - step + step - 1) / step;
+    return {n, lead, step, count};
+}
+
+template <typename Container>
+using element_t =
+    std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<Container &>().data())>>;
+}  // namespace detail
+
+// Calls f(element) for every element.
+template <typename Container, typename Function>
+void for_each(Container &container, Function f, thread_pool &pool = default_pool());
+
+// output[i] = f(input[i]). The output must hold at least input.size() elements, it may be the
+// input itself.
+template <typename InputContainer, typename OutputContainer, typename Function>
+void transform(const InputContainer &input, OutputContainer &output, Function f,
+               thread_pool &pool = default_pool());
+
+// Folds the elements into init with op, which must be associative. Chunks are combined in order,
+// so op does not need to be commutative.
+template <typename Container, typename T, typename BinaryOp = std::plus<>>
+T reduce(const Container &container, T init, BinaryOp op = BinaryOp(),
+         thread_pool &pool = default_pool());
+
+// output[i] = input[0] op ... op input[i], op must be associative. The output must hold at least
+// input.size() elements, it may be the input itself.
+template <typename InputContainer, typename OutputContainer, typename BinaryOp = std::plus<>>
+void inclusive_scan(const InputContainer &input, OutputContainer &output,
+                    BinaryOp op = BinaryOp(), thread_pool &pool = default_pool());
+}  // namespace parallel
+}  // namespace containers
+
+inline containers::parallel::thread_pool::thread_pool(size_t threads) {
+    try {
+        for (size_t i = 1; i < threads; ++i) workers_.emplace_back([this] { work(); });
+    } catch (...) {
+        // the workers already running would make the destructor of workers_ terminate
+        shut_down();
+        throw;
+    }
+}
+
+inline containers::parallel::thread_pool::~thread_pool() { shut_down(); }
+
+inline void containers::parallel::thread_pool::shut_down() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) worker.join();
+}
+
+template <typename Task>
+void containers::parallel::thread_pool::run(size_t tasks, Task &&task) {
+    if (tasks == 0) return;
+    if (workers_.empty() || tasks == 1 || current_ == this) {
+        for (size_t i = 0; i < tasks; ++i) task(i);
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        invoke_ = [](void *job, size_t i) {
+            (*static_cast<std::remove_reference_t<Task> *>(job))(i);
+        };
+        job_ = const_cast<void *>(static_cast<const void *>(std::addressof(task)));
+        tasks_ = tasks;
+        next_.store(0, std::memory_order_relaxed);
+        error_ = nullptr;
+        active_ = workers_.size();
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    execute();
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+    if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+}
+
+inline void containers::parallel::thread_pool::work() {
+    size_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+        }
+        execute();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) done_.notify_one();
+        }
+    }
+}
+
+inline void containers::parallel::thread_pool::execute() {
+    const thread_pool *outer = std::exchange(current_, this);
+    for (size_t i; (i = next_.fetch_add(1, std::memory_order_relaxed)) < tasks_;) {
+        try {
+            invoke_(job_, i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) error_ = std::current_exception();
+        }
+    }
+    current_ = outer;
+}
+
+template <typename Container, typename Function>
+void containers::parallel::for_each(Container &container, Function f, thread_pool &pool) {
+    auto *data = container.data();
+    detail::partition chunks = detail::make_partition(data, container.size(), pool.size());
+    pool.run(chunks.count, [&](size_t chunk) {
+        for (size_t i = chunks.begin(chunk), last = chunks.end(chunk); i < last; ++i) f(data[i]);
+    });
+}
+
+template <typename InputContainer, typename OutputContainer, typename Function>
+void containers::parallel::transform(const InputContainer &input, OutputContainer &output,
+                                     Function f, thread_pool &pool) {
+    if (output.size() < input.size()) {
+        throw std::length_error("length_error");
+    }
+    const auto *in = input.data();
+    auto *out = output.data();
+    // partitioned by the output, that is where the chunks must not share cache lines
+    detail::partition chunks = detail::make_partition(out, input.size(), pool.size());
+    pool.run(chunks.count, [&](size_t chunk) {
+        for (size_t i = chunks.begin(chunk), last = chunks.end(chunk); i < last; ++i) {
+            out[i] = f(in[i]);
+        }
+    });
+}
+
+template <typename Container, typename T, typename BinaryOp>
+T containers::parallel::reduce(const Container &container, T init, BinaryOp op,
+                               thread_pool &pool) {
+    if (container.size() == 0) return init;
+    const auto *data = container.data();
+    detail::partition chunks = detail::make_partition(data, container.size(), pool.size());
+
+    vector<std::optional<T>> partials(chunks.count);
+    pool.run(chunks.count, [&](size_t chunk) {
+        size_t i = chunks.begin(chunk), last = chunks.end(chunk);
+        T partial = data[i];
+        for (++i; i < last; ++i) partial = op(std::move(partial), data[i]);
+        partials[chunk] = std::move(partial);
+    });
+    for (size_t chunk = 0; chunk < chunks.count; ++chunk) {
+        init = op(std::move(init), std::move(*partials[chunk]));
+    }
+    return init;
+}
+
+template <typename InputContainer, typename OutputContainer, typename BinaryOp>
+void containers::parallel::inclusive_scan(const InputContainer &input, OutputContainer &output,
+                                          BinaryOp op, thread_pool &pool) {
+    using T = detail::element_t<OutputContainer>;
+    if (output.size() < input.size()) {
+        throw std::length_error("length_error");
+    }
+    if (input.size() == 0) return;
+    const auto *in = input.data();
+    T *out = output.data();
+    detail::partition chunks = detail::make_partition(out, input.size(), pool.size());
+
+    // pass 1 sums every chunk but the last, pass 2 scans each chunk starting from the sum of the
+    // chunks before it
+    vector<std::optional<T>> carries(chunks.count);
+    pool.run(chunks.count - 1, [&](size_t chunk) {
+        size_t i = chunks.begin(chunk), last = chunks.end(chunk);
+        T sum = in[i];
+        for (++i; i < last; ++i) sum = op(std::move(sum), in[i]);
+        carries[chunk + 1] = std::move(sum);
+    });
+    for (size_t chunk = 2; chunk < chunks.count; ++chunk) {
+        carries[chunk] = op(*carries[chunk - 1], std::move(*carries[chunk]));
+    }
+    pool.run(chunks.count, [&](size_t chunk) {
+        size_t i = chunks.begin(chunk), last = chunks.end(chunk);
+        T sum = chunk == 0 ? T(in[i]) : op(std::move(*carries[chunk]), in[i]);
+        out[i] = sum;
+        for (++i; i < last; ++i) {
+            sum = op(std::move(sum), in[i]);
+            out[i] = sum;
+        }
+    });
+}
+
+#endif
@@ -0,0 +1,269 @@
+#ifndef CONTAINERS_PRIORITY_QUEUE
+#define CONTAINERS_PRIORITY_QUEUE
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "vector.h"
+
+namespace containers {
+// Heap of Arity children per node kept in a random-access container, the greatest element
+// according to Compare on top. A 4-ary heap is half as deep as a binary one and the children of a
+// node share a cache line, so pop touches far fewer lines at the cost of a few more comparisons
+// per level; Arity = 2 gives the classic binary heap. Elements move through holes instead of
+// being swapped.
+template <typename T, typename _container = containers::vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 4>
+class priority_queue {
+    static_assert(Arity >= 2, "a heap node needs at least two children");
+
+    using value_type = T;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+   private:
+    _container heap_;
+    Compare compare_;
+
+    // moves the element at index towards the root while it outranks its parent
+    void sift_up(size_type index);
+    // moves value into the hole at index and down while a child outranks it
+    void sift_down(size_type index, value_type value);
+    // Moves the hole at index all the way down along the greatest children, then value up from
+    // there. The element that replaces the top usually belongs near the bottom, so this saves the
+    // comparison against value on every level of the way down.
+    void sift_hole_down(size_type index, value_type value);
+    // restores the heap order of the whole container in O(n)
+    void heapify();
+
+   public:
+    // Priority queue Member functions
+    priority_queue();
+    explicit priority_queue(const Compare &compare);
+    priority_queue(std::initializer_list<T> const &items);
+    template <typename InputIt>
+    priority_queue(InputIt first, InputIt last, const Compare &compare = Compare());
+    priority_queue(const priority_queue &q);
+    priority_queue(priority_queue &&q);
+    priority_queue &operator=(const priority_queue &q);
+    priority_queue &operator=(priority_queue &&q);
+    ~priority_queue();
+
+    // Priority queue Element access
+    const_reference top() const noexcept;
+
+    // Priority queue Capacity
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // Priority queue Modifiers
+    void push(const_reference value);
+    void push(value_type &&value);
+    template <typename... Args>
+    void emplace(Args &&...args);
+    // Adds every element of range, rebuilding the heap in O(n) when the range is not small
+    // compared to the queue.
+    template <typename Range>
+    void push_range(const Range &range);
+    void pop();
+    // Replaces the top element with value in one pass down the heap, cheaper than pop() and push().
+    void pop_push(value_type value);
+    void swap(priority_queue &other) noexcept;
+};
+}  // namespace containers
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+containers::priority_queue<T, _container, Compare, Arity>::priority_queue() {}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+containers::priority_queue<T, _container, Compare, Arity>::priority_queue(const Compare &compare)
+    : compare_(compare) {}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+containers::priority_queue<T, _container, Compare, Arity>::priority_queue(
+    std::initializer_list<T> const &items)
+    : priority_queue(items.begin(), items.end()) {}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+template <typename InputIt>
+containers::priority_queue<T, _container, Compare, Arity>::priority_queue(InputIt first,
+                                                                          InputIt last,
+                                                                          const Compare &compare)
+    : compare_(compare) {
+    for (; first != last; ++first) heap_.push_back(*first);
+    heapify();
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+containers::priority_queue<T, _container, Compare, Arity>::priority_queue(const priority_queue &q)
+    : heap_(q.heap_), compare_(q.compare_) {}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+containers::priority_queue<T, _container, Compare, Arity>::priority_queue(priority_queue &&q)
+    : heap_(std::move(q.heap_)), compare_(std::move(q.compare_)) {}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+containers::priority_queue<T, _container, Compare, Arity> &
+containers::priority_queue<T, _container, Compare, Arity>::operator=(const priority_queue &q) {
+    if (this != &q) {
+        heap_ = q.heap_;
+        compare_ = q.compare_;
+    }
+    return *this;
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+containers::priority_queue<T, _container, Compare, Arity> &
+containers::priority_queue<T, _container, Compare, Arity>::operator=(priority_queue &&q) {
+    if (this != &q) {
+        heap_ = std::move(q.heap_);
+        compare_ = std::move(q.compare_);
+    }
+    return *this;
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+containers::priority_queue<T, _container, Compare, Arity>::~priority_queue() {}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+typename containers::priority_queue<T, _container, Compare, Arity>::const_reference
+containers::priority_queue<T, _container, Compare, Arity>::top() const noexcept {
+    return heap_[0];
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+bool containers::priority_queue<T, _container, Compare, Arity>::empty() const noexcept {
+    return heap_.empty();
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+size_t containers::priority_queue<T, _container, Compare, Arity>::size() const noexcept {
+    return heap_.size();
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::sift_up(size_type index) {
+    if (index == 0) return;
+    size_type parent = (index - 1) / Arity;
+    if (!compare_(heap_[parent], heap_[index])) return;
+    value_type value(std::move(heap_[index]));
+    do {
+        heap_[index] = std::move(heap_[parent]);
+        index = parent;
+        if (index == 0) break;
+        parent = (index - 1) / Arity;
+    } while (compare_(heap_[parent], value));
+    heap_[index] = std::move(value);
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::sift_down(size_type index,
+                                                                          value_type value) {
+    const size_type count = heap_.size();
+    for (;;) {
+        size_type first = index * Arity + 1;
+        if (first >= count) break;
+        size_type last = first + Arity < count ? first + Arity : count;
+        size_type best = first;
+        for (size_type child = first + 1; child < last; ++child) {
+            best = compare_(heap_[best], heap_[child]) ? child : best;
+        }
+        if (!compare_(value, heap_[best])) break;
+        heap_[index] = std::move(heap_[best]);
+        index = best;
+    }
+    heap_[index] = std::move(value);
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::sift_hole_down(size_type index,
+                                                                               value_type value) {
+    const size_type count = heap_.size();
+    for (;;) {
+        size_type first = index * Arity + 1;
+        if (first >= count) break;
+        size_type last = first + Arity < count ? first + Arity : count;
+        size_type best = first;
+        for (size_type child = first + 1; child < last; ++child) {
+            best = compare_(heap_[best], heap_[child]) ? child : best;
+        }
+        heap_[index] = std::move(heap_[best]);
+        index = best;
+    }
+    heap_[index] = std::move(value);
+    sift_up(index);
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::heapify() {
+    size_type count = heap_.size();
+    if (count < 2) return;
+    // Floyd's construction: sift down every parent, deepest first
+    for (size_type parent = (count - 2) / Arity + 1; parent-- > 0;) {
+        sift_down(parent, value_type(std::move(heap_[parent])));
+    }
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::push(const_reference value) {
+    heap_.push_back(value);
+    sift_up(heap_.size() - 1);
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::push(value_type &&value) {
+    heap_.push_back(std::move(value));
+    sift_up(heap_.size() - 1);
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+template <typename... Args>
+void containers::priority_queue<T, _container, Compare, Arity>::emplace(Args &&...args) {
+    heap_.emplace_back(std::forward<Args>(args)...);
+    sift_up(heap_.size() - 1);
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+template <typename Range>
+void containers::priority_queue<T, _container, Compare, Arity>::push_range(const Range &range) {
+    size_type old_size = heap_.size();
+    for (const auto &item : range) heap_.push_back(item);
+    size_type added = heap_.size() - old_size;
+    // a rebuild costs about two comparisons per element, a sift up at most one per level
+    if (added > old_size) {
+        heapify();
+    } else {
+        for (size_type i = old_size; i < heap_.size(); ++i) sift_up(i);
+    }
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::pop() {
+    if (heap_.size() > 1) {
+        value_type last(std::move(heap_.back()));
+        heap_.pop_back();
+        sift_hole_down(0, std::move(last));
+    } else {
+        heap_.pop_back();
+    }
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::pop_push(value_type value) {
+    if (heap_.empty()) {
+        heap_.push_back(std::move(value));
+    } else {
+        sift_hole_down(0, std::move(value));
+    }
+}
+
+template <typename T, typename _container, typename Compare, size_t Arity>
+void containers::priority_queue<T, _container, Compare, Arity>::swap(
+    priority_queue &other) noexcept {
+    std::swap(heap_, other.heap_);
+    std::swap(compare_, other.compare_);
+}
+
+#endif
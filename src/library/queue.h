@@ -2,12 +2,14 @@
 #define CONTAINERS_QUEUE
 
 #include <cstddef>
+#include <utility>
 
-#include "list.h"
+#include "circular_buffer.h"
 
 namespace containers {
-template <typename T, typename _container = containers::list<T>>
+template <typename T, typename _container = containers::circular_buffer<T>>
 class queue {
+    using value_type = T;
     using size_type = size_t;
     using const_reference = const T &;
     using reference = T &;
@@ -25,7 +27,9 @@ class queue {
     ~queue();  // called by default
 
     // Queue Element access
+    reference front() noexcept;
     const_reference front() const noexcept;
+    reference back() noexcept;
     const_reference back() const noexcept;
 
     // Queue Capacity
@@ -34,6 +38,9 @@ class queue {
 
     // Queue Modifiers
     void push(const_reference value) noexcept;
+    void push(value_type &&value);
+    template <typename... Args>
+    reference emplace(Args &&...args);
     void pop() noexcept;
     void swap(queue &other) noexcept;
 };
@@ -44,8 +51,7 @@ containers::queue<T, _container>::queue() {}
 
 template <typename T, typename _container>
 containers::queue<T, _container>::queue(std::initializer_list<T> const &items) {
-    for (T i : items) push(i);
-    queue_.print();
+    for (auto &item : items) push(item);
 }
 
 template <typename T, typename _container>
@@ -75,24 +81,46 @@ size_t containers::queue<T, _container>::size() const noexcept {
     return queue_.size();
 }
 
+template <typename T, typename _container>
+typename containers::queue<T, _container>::reference containers::queue<T, _container>::front() noexcept {
+    return queue_.front();
+}
+
 template <typename T, typename _container>
 typename containers::queue<T, _container>::const_reference containers::queue<T, _container>::front() const noexcept {
+    return queue_.front();
+}
+
+template <typename T, typename _container>
+typename containers::queue<T, _container>::reference containers::queue<T, _container>::back() noexcept {
     return queue_.back();
 }
 
 template <typename T, typename _container>
 typename containers::queue<T, _container>::const_reference containers::queue<T, _container>::back() const noexcept {
-    return queue_.front();
+    return queue_.back();
 }
 
 template <typename T, typename _container>
 void containers::queue<T, _container>::pop() noexcept {
-    queue_.pop_back();
+    queue_.pop_front();
 }
 
 template <typename T, typename _container>
 void containers::queue<T, _container>::push(const_reference value) noexcept {
-    queue_.push_front(value);
+    queue_.push_back(value);
+}
+
+template <typename T, typename _container>
+void containers::queue<T, _container>::push(value_type &&value) {
+    queue_.push_back(std::move(value));
+}
+
+template <typename T, typename _container>
+template <typename... Args>
+typename containers::queue<T, _container>::reference containers::queue<T, _container>::emplace(
+    Args &&...args) {
+    return queue_.emplace_back(std::forward<Args>(args)...);
 }
 
 template <typename T, typename _container>
@@ -0,0 +1,192 @@
+#ifndef CONTAINERS_RELOCATE
+#define CONTAINERS_RELOCATE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace containers {
+// Trait telling the containers that moving an object to a new address and forgetting the old one
+// is the same as copying its bytes. Specialize it for own types that are not trivially copyable
+// but own no self-references (e.g. a struct holding a std::unique_ptr).
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+namespace detail {
+// Allocators may provide `T *reallocate(T *p, size_t old_n, size_t new_n)` that resizes a block and
+// keeps its bytes. Containers use it instead of allocate + relocate + deallocate when the elements
+// are trivially relocatable.
+template <typename Allocator, typename T, typename = void>
+struct has_reallocate : std::false_type {};
+
+template <typename Allocator, typename T>
+struct has_reallocate<Allocator, T,
+                      std::void_t<decltype(std::declval<Allocator &>().reallocate(
+                          std::declval<T *>(), std::declval<size_t>(), std::declval<size_t>()))>>
+    : std::true_type {};
+
+template <typename Allocator, typename T>
+inline constexpr bool can_reallocate_v =
+    has_reallocate<Allocator, T>::value && is_trivially_relocatable_v<T>;
+
+// True when moving T to new storage cannot throw: its bytes may be copied or its move constructor
+// is noexcept.
+template <typename T>
+inline constexpr bool is_nothrow_relocatable_v =
+    is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+
+// Relocation helpers work on raw storage: after a call the source range is uninitialized memory
+// and the destination range holds live objects. When an element may throw while it is copied, the
+// helpers copy every element before destroying any source, so a throw leaves the sources as they
+// were and the destination empty.
+
+// Constructs copies (moves, for move-only types) of [first, first + n) at dest, destroying the
+// copies already made when one throws. The sources stay alive.
+template <typename T>
+void relocate_construct(T *first, size_t n, T *dest) {
+    size_t i = 0;
+    try {
+        for (; i < n; ++i) ::new (static_cast<void *>(dest + i)) T(std::move_if_noexcept(first[i]));
+    } catch (...) {
+        for (; i > 0; --i) dest[i - 1].~T();
+        throw;
+    }
+}
+
+// Relocates [first, first + n) to non-overlapping uninitialized storage at dest.
+template <typename T>
+void relocate(T *first, size_t n, T *dest) noexcept(is_nothrow_relocatable_v<T>) {
+    if constexpr (is_trivially_relocatable_v<T>) {
+        if (n) std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), n * sizeof(T));
+    } else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+        for (size_t i = 0; i < n; ++i) {
+            ::new (static_cast<void *>(dest + i)) T(std::move(first[i]));
+            first[i].~T();
+        }
+    } else {
+        relocate_construct(first, n, dest);
+        for (size_t i = 0; i < n; ++i) first[i].~T();
+    }
+}
+
+// Relocates two ranges at once, e.g. the elements in front of and behind a gap: if a copy throws,
+// neither source has been touched.
+template <typename T>
+void relocate(T *first1, size_t n1, T *dest1, T *first2, size_t n2,
+              T *dest2) noexcept(is_nothrow_relocatable_v<T>) {
+    if constexpr (is_nothrow_relocatable_v<T>) {
+        relocate(first1, n1, dest1);
+        relocate(first2, n2, dest2);
+    } else {
+        relocate_construct(first1, n1, dest1);
+        try {
+            relocate_construct(first2, n2, dest2);
+        } catch (...) {
+            for (size_t i = 0; i < n1; ++i) dest1[i].~T();
+            throw;
+        }
+        for (size_t i = 0; i < n1; ++i) first1[i].~T();
+        for (size_t i = 0; i < n2; ++i) first2[i].~T();
+    }
+}
+
+// Relocates [first, first + n) to dest inside the same buffer, ranges may overlap. A failed copy
+// cannot be undone in place, so for types that are not nothrow relocatable n must be 0: containers
+// shift those by assignment (erase_shift, insert_shift).
+template <typename T>
+void relocate_overlapping(T *first, size_t n, T *dest) noexcept(is_nothrow_relocatable_v<T>) {
+    if constexpr (is_trivially_relocatable_v<T>) {
+        if (n) std::memmove(static_cast<void *>(dest), static_cast<const void *>(first), n * sizeof(T));
+    } else if (dest < first) {
+        for (size_t i = 0; i < n; ++i) {
+            ::new (static_cast<void *>(dest + i)) T(std::move_if_noexcept(first[i]));
+            first[i].~T();
+        }
+    } else if (dest > first) {
+        for (size_t i = n; i > 0; --i) {
+            ::new (static_cast<void *>(dest + i - 1)) T(std::move_if_noexcept(first[i - 1]));
+            first[i - 1].~T();
+        }
+    }
+}
+
+// Removes *first from the live range [first, first + n) and shifts the rest down one slot, leaving
+// first[n - 1] uninitialized. Types that may throw while moved are shifted by move assignment, so
+// every slot stays alive if an assignment throws.
+template <typename T>
+void erase_shift(T *first, size_t n) noexcept(is_nothrow_relocatable_v<T>) {
+    if constexpr (is_nothrow_relocatable_v<T>) {
+        first->~T();
+        relocate_overlapping(first + 1, n - 1, first);
+    } else {
+        std::move(first + 1, first + n, first);
+        first[n - 1].~T();
+    }
+}
+
+// Destroys [first, first + n), a no-op for trivially destructible types.
+template <typename T>
+void destroy(T *first, size_t n) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_t i = 0; i < n; ++i) first[i].~T();
+    } else {
+        (void)first;
+        (void)n;
+    }
+}
+// Moves values[0, count) in front of the live range [first, first + n), which must be followed by
+// count uninitialized slots, like std::vector::insert: the last elements are copied past the end
+// and the rest are shifted by assignment. If a copy or an assignment throws, [first, first + n) is
+// still alive and the slots past it are uninitialized again.
+template <typename T>
+void insert_shift(T *first, size_t n, T *values, size_t count) {
+    size_t moved = std::min(n, count);  // elements that end up past the old end
+    size_t fresh = count - moved;       // values constructed past the old end
+    T *end = first + n;
+    relocate_construct(values + moved, fresh, end);
+    try {
+        relocate_construct(first + n - moved, moved, end + fresh);
+    } catch (...) {
+        destroy(end, fresh);
+        throw;
+    }
+    try {
+        std::move_backward(first, first + n - moved, end);
+        std::move(values, values + moved, first);
+    } catch (...) {
+        destroy(end, count);
+        throw;
+    }
+}
+
+// Copies [first, last) into uninitialized storage at dest and returns the end of the copy. Works with
+// iterators that do not specialize std::iterator_traits.
+template <typename It, typename T>
+T *uninitialized_copy(It first, It last, T *dest) {
+    if constexpr (std::is_pointer_v<It> && std::is_trivially_copyable_v<T> &&
+                  std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T>) {
+        size_t n = last - first;
+        if (n) std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), n * sizeof(T));
+        return dest + n;
+    } else {
+        T *current = dest;
+        try {
+            for (; first != last; ++first, ++current) ::new (static_cast<void *>(current)) T(*first);
+        } catch (...) {
+            for (; dest != current; ++dest) dest->~T();
+            throw;
+        }
+        return current;
+    }
+}
+
+}  // namespace detail
+}  // namespace containers
+
+#endif
@@ -0,0 +1,83 @@
+// Kernels shared by every instruction set of algorithm.h. This file has no include guard on
+// purpose: algorithm.h includes it once per instruction set, inside a namespace that defines
+// `ops<T>` for the lanes of that set and under the matching target pragma, so the same source is
+// compiled to SSE2, AVX2 and AVX-512 code.
+//
+// ops<T> provides `vec`, `width` (lanes per vector), load, store, set1, min, max and eq, which
+// returns one bit per lane in a uint64_t. bit_count(mask) counts the set bits of such a mask.
+
+template <typename T>
+size_t find(const T *first, size_t n, T value) noexcept {
+    using op = ops<T>;
+    const typename op::vec needle = op::set1(value);
+    size_t i = 0;
+    for (; i + op::width <= n; i += op::width) {
+        uint64_t mask = op::eq(op::load(first + i), needle);
+        if (mask) return i + __builtin_ctzll(mask);
+    }
+    for (; i < n; ++i) {
+        if (first[i] == value) return i;
+    }
+    return n;
+}
+
+template <typename T>
+size_t count(const T *first, size_t n, T value) noexcept {
+    using op = ops<T>;
+    const typename op::vec needle = op::set1(value);
+    size_t result = 0, i = 0;
+    for (; i + op::width <= n; i += op::width) {
+        result += bit_count(op::eq(op::load(first + i), needle));
+    }
+    for (; i < n; ++i) result += first[i] == value;
+    return result;
+}
+
+template <typename T>
+bool equal(const T *first1, const T *first2, size_t n) noexcept {
+    using op = ops<T>;
+    constexpr uint64_t all = op::width == 64 ? ~uint64_t(0) : (uint64_t(1) << op::width) - 1;
+    size_t i = 0;
+    for (; i + op::width <= n; i += op::width) {
+        if (op::eq(op::load(first1 + i), op::load(first2 + i)) != all) return false;
+    }
+    for (; i < n; ++i) {
+        if (!(first1[i] == first2[i])) return false;
+    }
+    return true;
+}
+
+template <typename T>
+void fill(T *first, size_t n, T value) noexcept {
+    using op = ops<T>;
+    const typename op::vec pattern = op::set1(value);
+    size_t i = 0;
+    for (; i + op::width <= n; i += op::width) op::store(first + i, pattern);
+    for (; i < n; ++i) first[i] = value;
+}
+
+// Index of the first smallest (Max = false) or largest element, n for an empty range. The extreme
+// value is reduced with vector min/max first and then located with find.
+template <bool Max, typename T>
+size_t extreme_index(const T *first, size_t n) noexcept {
+    using op = ops<T>;
+    if (n == 0) return 0;
+    T best = first[0];
+    size_t i = 0;
+    if (n >= op::width) {
+        typename op::vec acc = op::load(first);
+        for (i = op::width; i + op::width <= n; i += op::width) {
+            acc = Max ? op::max(acc, op::load(first + i)) : op::min(acc, op::load(first + i));
+        }
+        T lanes[op::width];
+        op::store(lanes, acc);
+        best = lanes[0];
+        for (size_t lane = 1; lane < op::width; ++lane) {
+            if (Max ? best < lanes[lane] : lanes[lane] < best) best = lanes[lane];
+        }
+    }
+    for (; i < n; ++i) {
+        if (Max ? best < first[i] : first[i] < best) best = first[i];
+    }
+    return find(first, n, best);
+}
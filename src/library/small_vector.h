@@ -0,0 +1,623 @@
+#ifndef CONTAINERS_SMALL_VECTOR
+#define CONTAINERS_SMALL_VECTOR
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "bounds_check.h"
+#include "iterator.h"
+#include "relocate.h"
+
+namespace containers {
+// Vector that keeps up to N elements inside the object and moves them to the heap only when the
+// size grows beyond N.
+template <typename T, size_t N, typename Allocator = std::allocator<T>>
+class small_vector {
+    static_assert(N > 0, "small_vector needs room for at least one inline element");
+
+    using size_type = size_t;
+    using value_type = T;
+    using const_reference = const T &;
+    using reference = T &;
+
+   private:
+    T *data_;
+    size_type size_;
+    size_type capacity_;
+    Allocator allocator_;
+    alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+    T *inline_data() noexcept { return reinterpret_cast<T *>(buffer_); }
+    bool is_inline() const noexcept { return data_ == reinterpret_cast<const T *>(buffer_); }
+    void release() noexcept;
+    void steal(small_vector &other) noexcept(detail::is_nothrow_relocatable_v<T>);
+    void reallocate(size_type new_capacity);
+    size_type recommended_capacity(size_type required) const noexcept;
+    template <typename Construct>
+    void insert_gap(size_type index, size_type count, Construct construct);
+    // true when arg is one of the elements, which insert_gap may relocate before it is read
+    template <typename U>
+    bool holds(const U &arg) const noexcept;
+
+   public:
+    using iterator = contiguous_iterator<T>;
+    using const_iterator = contiguous_iterator<const T>;
+
+    // Small vector Member functions
+    small_vector();
+    small_vector(std::ptrdiff_t n);
+    small_vector(const std::initializer_list<T> &items);
+    small_vector(const small_vector &other);
+    small_vector(small_vector &&other);
+    small_vector &operator=(const small_vector &right);
+    small_vector &operator=(small_vector &&right);
+    ~small_vector();
+
+    // Small vector Element access
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+    reference operator[](size_type pos) noexcept;
+    const_reference operator[](size_type pos) const noexcept;
+    reference front() const;
+    reference back() const;
+    T *data() noexcept;
+    const T *data() const noexcept;
+
+    // Small vector Iterators
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    // Small vector Capacity
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+    void reserve(size_type size);
+    size_type capacity() const noexcept;
+    void shrink_to_fit();
+    static constexpr size_type inline_capacity() noexcept { return N; }
+
+    // Small vector Modifiers
+    void clear();
+    iterator insert(const_iterator pos, const_reference value);
+    iterator insert(const_iterator pos, value_type &&value);
+    template <typename InputIt, typename = std::enable_if_t<detail::is_iterator_v<InputIt>>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+    iterator erase(const_iterator pos);
+    void push_back(const_reference value);
+    void push_back(value_type &&value);
+    void pop_back();
+    void swap(small_vector &other);
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+
+    template <typename... Args>
+    reference emplace_back(Args &&...args);
+
+    template <typename InputIt, typename = std::enable_if_t<detail::is_iterator_v<InputIt>>>
+    void assign(InputIt first, InputIt last);
+
+    template <typename Range>
+    void append_range(const Range &range);
+
+    // Bonus
+    template <typename... Args>
+    iterator insert_many(const_iterator pos, Args &&...args);
+
+    template <typename... Args>
+    void insert_many_back(Args &&...args);
+
+    template <typename... Args>
+    void insert_many_front(Args &&...args);
+
+    // Other
+    void print() const noexcept;
+};
+}  // namespace containers
+
+template <typename T, size_t N, typename Allocator>
+containers::small_vector<T, N, Allocator>::small_vector()
+    : data_(inline_data()), size_(0), capacity_(N) {}
+
+template <typename T, size_t N, typename Allocator>
+containers::small_vector<T, N, Allocator>::small_vector(std::ptrdiff_t n) : small_vector() {
+    if (n < 0) {
+        throw std::length_error("length_error");
+    }
+    reserve(n);
+    std::uninitialized_value_construct_n(data_, n);
+    size_ = n;
+}
+
+template <typename T, size_t N, typename Allocator>
+containers::small_vector<T, N, Allocator>::small_vector(const std::initializer_list<T> &items)
+    : small_vector() {
+    reserve(items.size());
+    std::uninitialized_copy(items.begin(), items.end(), data_);
+    size_ = items.size();
+}
+
+template <typename T, size_t N, typename Allocator>
+containers::small_vector<T, N, Allocator>::small_vector(const small_vector &other)
+    : small_vector() {
+    reserve(other.size_);
+    std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+    size_ = other.size_;
+}
+
+template <typename T, size_t N, typename Allocator>
+containers::small_vector<T, N, Allocator>::small_vector(small_vector &&other) : small_vector() {
+    steal(other);
+}
+
+template <typename T, size_t N, typename Allocator>
+containers::small_vector<T, N, Allocator> &containers::small_vector<T, N, Allocator>::operator=(
+    const small_vector &right) {
+    if (this != &right) {
+        clear();
+        reserve(right.size_);
+        std::uninitialized_copy(right.data_, right.data_ + right.size_, data_);
+        size_ = right.size_;
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Allocator>
+containers::small_vector<T, N, Allocator> &containers::small_vector<T, N, Allocator>::operator=(
+    small_vector &&right) {
+    if (this != &right) {
+        clear();
+        release();
+        steal(right);
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Allocator>
+containers::small_vector<T, N, Allocator>::~small_vector() {
+    detail::destroy(data_, size_);
+    release();
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::reference
+containers::small_vector<T, N, Allocator>::at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return data_[pos];
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::const_reference
+containers::small_vector<T, N, Allocator>::at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return data_[pos];
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::reference
+containers::small_vector<T, N, Allocator>::operator[](size_type pos) noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return data_[pos];
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::const_reference
+containers::small_vector<T, N, Allocator>::operator[](size_type pos) const noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return data_[pos];
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::reference
+containers::small_vector<T, N, Allocator>::front() const {
+    return data_[0];
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::reference
+containers::small_vector<T, N, Allocator>::back() const {
+    return data_[size_ - 1];
+}
+
+template <typename T, size_t N, typename Allocator>
+T *containers::small_vector<T, N, Allocator>::data() noexcept {
+    return data_;
+}
+
+template <typename T, size_t N, typename Allocator>
+const T *containers::small_vector<T, N, Allocator>::data() const noexcept {
+    return data_;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::iterator
+containers::small_vector<T, N, Allocator>::begin() noexcept {
+    return data_;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::const_iterator
+containers::small_vector<T, N, Allocator>::begin() const noexcept {
+    return data_;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::const_iterator
+containers::small_vector<T, N, Allocator>::cbegin() const noexcept {
+    return data_;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::iterator
+containers::small_vector<T, N, Allocator>::end() noexcept {
+    return data_ + size_;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::const_iterator
+containers::small_vector<T, N, Allocator>::end() const noexcept {
+    return data_ + size_;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::const_iterator
+containers::small_vector<T, N, Allocator>::cend() const noexcept {
+    return data_ + size_;
+}
+
+template <typename T, size_t N, typename Allocator>
+bool containers::small_vector<T, N, Allocator>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::size_type
+containers::small_vector<T, N, Allocator>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::size_type
+containers::small_vector<T, N, Allocator>::max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::size_type
+containers::small_vector<T, N, Allocator>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::reserve(size_type size) {
+    if (size > capacity_ && size < max_size()) {
+        reallocate(size);
+    }
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::shrink_to_fit() {
+    if (!is_inline() && size_ < capacity_) {
+        reallocate(size_);
+    }
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::clear() {  // capacity_ remains, size_ = zero
+    detail::destroy(data_, size_);
+    size_ = 0;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::iterator
+containers::small_vector<T, N, Allocator>::insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::iterator
+containers::small_vector<T, N, Allocator>::insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename InputIt, typename>
+typename containers::small_vector<T, N, Allocator>::iterator
+containers::small_vector<T, N, Allocator>::insert(const_iterator pos, InputIt first,
+                                                  InputIt last) {
+    if (pos < begin() || pos > end()) {
+        throw std::out_of_range("out_of_range");
+    }
+
+    size_type index = pos - cbegin();
+    if constexpr (detail::is_single_pass_v<InputIt>) {
+        size_type old_size = size_;
+        for (; first != last; ++first) emplace_back(*first);
+        std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    } else {
+        // [first, last) must not point into the small_vector
+        insert_gap(index, detail::distance(first, last),
+                   [&](T *slot) { detail::uninitialized_copy(first, last, slot); });
+    }
+
+    return begin() + index;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::iterator
+containers::small_vector<T, N, Allocator>::erase(const_iterator pos) {
+    if (pos < begin() || pos >= end()) {
+        throw std::out_of_range("out_of_range");
+    }
+
+    size_type index = pos - cbegin();
+    detail::erase_shift(data_ + index, size_ - index);
+    --size_;
+
+    return data_ + index;
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::push_back(const_reference value) {
+    emplace_back(value);
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::push_back(value_type &&value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::pop_back() {
+    if (size_ > 0) {
+        data_[size_ - 1].~T();
+        --size_;
+    }
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::swap(small_vector &other) {
+    if (!is_inline() && !other.is_inline()) {
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+    } else {
+        // inline elements cannot change owner by swapping pointers
+        small_vector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename... Args>
+typename containers::small_vector<T, N, Allocator>::iterator
+containers::small_vector<T, N, Allocator>::emplace(const_iterator pos, Args &&...args) {
+    if (pos < begin() || pos > end()) {
+        throw std::out_of_range("out_of_range");
+    }
+
+    size_type index = pos - cbegin();
+    if (index != size_ && size_ < capacity_) {
+        // the arguments may refer to elements that are about to be relocated
+        T temp(std::forward<Args>(args)...);
+        insert_gap(index, 1, [&](T *slot) { ::new (static_cast<void *>(slot)) T(std::move(temp)); });
+    } else {
+        insert_gap(index, 1,
+                   [&](T *slot) { ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...); });
+    }
+
+    return begin() + index;
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename... Args>
+typename containers::small_vector<T, N, Allocator>::reference
+containers::small_vector<T, N, Allocator>::emplace_back(Args &&...args) {
+    if (size_ < capacity_) {
+        ::new (static_cast<void *>(data_ + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+    } else {
+        insert_gap(size_, 1,
+                   [&](T *slot) { ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...); });
+    }
+    return data_[size_ - 1];
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename InputIt, typename>
+void containers::small_vector<T, N, Allocator>::assign(InputIt first, InputIt last) {
+    clear();
+    if constexpr (detail::is_single_pass_v<InputIt>) {
+        for (; first != last; ++first) emplace_back(*first);
+    } else {
+        size_type count = detail::distance(first, last);
+        reserve(count);
+        detail::uninitialized_copy(first, last, data_);
+        size_ = count;
+    }
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename Range>
+void containers::small_vector<T, N, Allocator>::append_range(const Range &range) {
+    insert(end(), std::begin(range), std::end(range));
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename... Args>
+typename containers::small_vector<T, N, Allocator>::iterator
+containers::small_vector<T, N, Allocator>::insert_many(const_iterator pos, Args &&...args) {
+    if (pos < begin() || pos > end()) {
+        throw std::out_of_range("out_of_range");
+    }
+
+    size_type index = pos - cbegin();
+
+    if ((holds(args) || ...)) {
+        // an argument is an element that may be relocated before it is read, build them first in
+        // a small_vector that keeps them inline
+        small_vector<T, sizeof...(Args)> temp;
+        (temp.emplace_back(std::forward<Args>(args)), ...);
+        insert_gap(index, sizeof...(Args),
+                   [&](T *first) { detail::relocate_construct(temp.data(), temp.size(), first); });
+        return begin() + index;
+    }
+
+    insert_gap(index, sizeof...(Args), [&](T *first) {
+        T *last = first;
+        try {
+            ((::new (static_cast<void *>(last)) T(std::forward<Args>(args)), ++last), ...);
+        } catch (...) {
+            detail::destroy(first, last - first);
+            throw;
+        }
+    });
+
+    return begin() + index;
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename... Args>
+void containers::small_vector<T, N, Allocator>::insert_many_back(Args &&...args) {
+    insert_many(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename... Args>
+void containers::small_vector<T, N, Allocator>::insert_many_front(Args &&...args) {
+    insert_many(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename U>
+bool containers::small_vector<T, N, Allocator>::holds(const U &arg) const noexcept {
+    if constexpr (std::is_same_v<U, T>) {
+        std::less<const T *> less;
+        return !less(&arg, data_) && less(&arg, data_ + size_);
+    } else {
+        (void)arg;
+        return false;
+    }
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::print() const noexcept {
+    for (auto &item : *this) std::cout << item << " ";
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::release() noexcept {
+    // the elements must already be destroyed or relocated
+    if (!is_inline()) {
+        allocator_.deallocate(data_, capacity_);
+        data_ = inline_data();
+        capacity_ = N;
+    }
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::steal(small_vector &other) noexcept(
+    detail::is_nothrow_relocatable_v<T>) {
+    // *this must be empty and inline
+    if (other.is_inline()) {
+        detail::relocate(other.data_, other.size_, data_);
+    } else {
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+        other.data_ = other.inline_data();
+        other.capacity_ = N;
+    }
+    size_ = other.size_;
+    other.size_ = 0;
+}
+
+template <typename T, size_t N, typename Allocator>
+void containers::small_vector<T, N, Allocator>::reallocate(size_type new_capacity) {
+    // moves the elements to a heap block of new_capacity, or back inline when they fit
+    T *new_data = new_capacity <= N ? inline_data() : allocator_.allocate(new_capacity);
+    if (new_data == data_) return;
+    try {
+        detail::relocate(data_, size_, new_data);
+    } catch (...) {
+        if (new_data != inline_data()) allocator_.deallocate(new_data, new_capacity);
+        throw;
+    }
+    release();
+    data_ = new_data;
+    capacity_ = new_capacity <= N ? N : new_capacity;
+}
+
+template <typename T, size_t N, typename Allocator>
+typename containers::small_vector<T, N, Allocator>::size_type
+containers::small_vector<T, N, Allocator>::recommended_capacity(size_type required) const noexcept {
+    return required > capacity_ * 2 ? required : capacity_ * 2;
+}
+
+template <typename T, size_t N, typename Allocator>
+template <typename Construct>
+void containers::small_vector<T, N, Allocator>::insert_gap(
+    size_type index, size_type count, Construct construct) {
+    // opens `count` uninitialized slots at `index` and fills them with `construct(first_slot)`
+    if (size_ + count > capacity_) {
+        // construct before relocating, the arguments may live in the old buffer
+        size_type new_capacity = recommended_capacity(size_ + count);
+        T *new_data = allocator_.allocate(new_capacity);
+        try {
+            construct(new_data + index);
+        } catch (...) {
+            allocator_.deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            detail::relocate(data_, index, new_data, data_ + index, size_ - index,
+                             new_data + index + count);
+        } catch (...) {
+            detail::destroy(new_data + index, count);
+            allocator_.deallocate(new_data, new_capacity);
+            throw;
+        }
+        release();
+        data_ = new_data;
+        capacity_ = new_capacity;
+    } else if (detail::is_nothrow_relocatable_v<T> || index == size_) {
+        detail::relocate_overlapping(data_ + index, size_ - index, data_ + index + count);
+        try {
+            construct(data_ + index);
+        } catch (...) {
+            detail::relocate_overlapping(data_ + index + count, size_ - index, data_ + index);
+            throw;
+        }
+    } else if constexpr (!detail::is_nothrow_relocatable_v<T>) {
+        // a failed copy cannot be undone in place, these are shifted by assignment; construct
+        // fills raw memory, so the new elements are built aside first
+        T *values = allocator_.allocate(count);
+        try {
+            construct(values);
+        } catch (...) {
+            allocator_.deallocate(values, count);
+            throw;
+        }
+        try {
+            detail::insert_shift(data_ + index, size_ - index, values, count);
+        } catch (...) {
+            detail::destroy(values, count);
+            allocator_.deallocate(values, count);
+            throw;
+        }
+        detail::destroy(values, count);
+        allocator_.deallocate(values, count);
+    }
+    size_ += count;
+}
+
+#endif
@@ -0,0 +1,446 @@
+#ifndef CONTAINERS_SORT
+#define CONTAINERS_SORT
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "parallel.h"
+#include "vector.h"
+
+// Sorting for contiguous containers (array, vector, small_vector). Arithmetic elements compared
+// with std::less or std::greater are sorted with LSD radix sort, everything else with
+// pattern-defeating quicksort (sort) or merge sort (stable_sort). Large inputs are sorted in
+// parallel on a thread pool: radix passes build per-chunk histograms, comparison sorts sort one
+// run per thread and merge the runs with merge path. Float ranges must not contain NaN.
+namespace containers {
+namespace detail {
+// Ranges shorter than this are sorted on the calling thread.
+inline constexpr size_t parallel_sort_threshold = size_t(1) << 16;
+
+template <typename T, typename Compare>
+struct radix_order {
+    static constexpr bool sortable = false;
+};
+
+template <typename T, typename Compare>
+struct arithmetic_order {
+    static constexpr bool sortable =
+        std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8 &&
+        (std::is_integral_v<T> || std::numeric_limits<T>::is_iec559);
+};
+
+// std::less and std::greater on arithmetic keys can be radix sorted, Descending flips the keys.
+template <typename T>
+struct radix_order<T, std::less<>> : arithmetic_order<T, std::less<>> {
+    static constexpr bool descending = false;
+};
+template <typename T>
+struct radix_order<T, std::less<T>> : arithmetic_order<T, std::less<T>> {
+    static constexpr bool descending = false;
+};
+template <typename T>
+struct radix_order<T, std::greater<>> : arithmetic_order<T, std::greater<>> {
+    static constexpr bool descending = true;
+};
+template <typename T>
+struct radix_order<T, std::greater<T>> : arithmetic_order<T, std::greater<T>> {
+    static constexpr bool descending = true;
+};
+
+// Unsigned key whose order matches the order of the values.
+template <bool Descending, typename T>
+auto radix_key(T value) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        if (value == T(0)) value = T(0);  // -0.0 and 0.0 are equivalent
+        U bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        U key = bits & sign ? U(~bits) : U(bits | sign);
+        return Descending ? U(~key) : key;
+    } else {
+        using U = std::make_unsigned_t<T>;
+        U key = static_cast<U>(value);
+        if constexpr (std::is_signed_v<T>) key = U(key ^ (U(1) << (sizeof(U) * 8 - 1)));
+        return Descending ? U(~key) : key;
+    }
+}
+
+template <bool Descending, typename T>
+unsigned radix_digit(T value, size_t pass) noexcept {
+    return static_cast<unsigned>((radix_key<Descending>(value) >> (pass * 8)) & 0xFF);
+}
+
+// Stable LSD radix sort with 8-bit digits. Passes whose digit is the same for every element are
+// skipped, so keys drawn from a small range cost one or two passes.
+template <bool Descending, typename T>
+void radix_sort(T *data, size_t n, parallel::thread_pool &pool) {
+    constexpr size_t passes = sizeof(T);
+    std::unique_ptr<T[]> buffer(new T[n]);
+    T *src = data, *dst = buffer.get();
+
+    if (n < parallel_sort_threshold || pool.size() == 1) {
+        size_t counts[passes][256] = {};
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t pass = 0; pass < passes; ++pass) {
+                ++counts[pass][radix_digit<Descending>(data[i], pass)];
+            }
+        }
+        for (size_t pass = 0; pass < passes; ++pass) {
+            size_t *offsets = counts[pass];
+            if (offsets[radix_digit<Descending>(src[0], pass)] == n) continue;
+            size_t running = 0;
+            for (size_t digit = 0; digit < 256; ++digit) {
+                running += std::exchange(offsets[digit], running);
+            }
+            for (size_t i = 0; i < n; ++i) {
+                dst[offsets[radix_digit<Descending>(src[i], pass)]++] = src[i];
+            }
+            std::swap(src, dst);
+        }
+    } else {
+        parallel::detail::partition chunks =
+            parallel::detail::make_partition(data, n, pool.size());
+        vector<std::array<size_t, 256>> counts(chunks.count);
+        for (size_t pass = 0; pass < passes; ++pass) {
+            pool.run(chunks.count, [&](size_t chunk) {
+                std::array<size_t, 256> &local = counts[chunk];
+                local.fill(0);
+                for (size_t i = chunks.begin(chunk), last = chunks.end(chunk); i < last; ++i) {
+                    ++local[radix_digit<Descending>(src[i], pass)];
+                }
+            });
+            // digit-major, chunk-minor offsets keep equal digits in their original order
+            size_t running = 0;
+            bool trivial = false;
+            for (size_t digit = 0; digit < 256 && !trivial; ++digit) {
+                size_t total = 0;
+                for (size_t chunk = 0; chunk < chunks.count; ++chunk) total += counts[chunk][digit];
+                trivial = total == n;
+            }
+            if (trivial) continue;
+            for (size_t digit = 0; digit < 256; ++digit) {
+                for (size_t chunk = 0; chunk < chunks.count; ++chunk) {
+                    running += std::exchange(counts[chunk][digit], running);
+                }
+            }
+            pool.run(chunks.count, [&](size_t chunk) {
+                std::array<size_t, 256> &offsets = counts[chunk];
+                for (size_t i = chunks.begin(chunk), last = chunks.end(chunk); i < last; ++i) {
+                    dst[offsets[radix_digit<Descending>(src[i], pass)]++] = src[i];
+                }
+            });
+            std::swap(src, dst);
+        }
+    }
+    if (src != data) std::memcpy(static_cast<void *>(data), src, n * sizeof(T));
+}
+
+// Pattern-defeating quicksort (Orson Peters): median-of-3 or ninther pivots, partial insertion
+// sort for already partitioned ranges, shuffles on unbalanced partitions and heapsort once too
+// many partitions were bad.
+namespace pdq {
+inline constexpr size_t insertion_threshold = 24;
+inline constexpr size_t ninther_threshold = 128;
+inline constexpr size_t partial_insertion_limit = 8;
+
+// Guarded unless Unguarded, which requires an element before begin that is not greater than any
+// element of the range.
+template <bool Unguarded, typename T, typename Compare>
+void insertion_sort(T *begin, T *end, Compare &comp) {
+    if (begin == end) return;
+    for (T *cur = begin + 1; cur != end; ++cur) {
+        if (comp(*cur, *(cur - 1))) {
+            T tmp = std::move(*cur);
+            T *sift = cur;
+            do {
+                *sift = std::move(*(sift - 1));
+                --sift;
+            } while ((Unguarded || sift != begin) && comp(tmp, *(sift - 1)));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// Insertion sort that gives up after moving partial_insertion_limit elements.
+template <typename T, typename Compare>
+bool partial_insertion_sort(T *begin, T *end, Compare &comp) {
+    if (begin == end) return true;
+    size_t moved = 0;
+    for (T *cur = begin + 1; cur != end; ++cur) {
+        if (comp(*cur, *(cur - 1))) {
+            T tmp = std::move(*cur);
+            T *sift = cur;
+            do {
+                *sift = std::move(*(sift - 1));
+                --sift;
+            } while (sift != begin && comp(tmp, *(sift - 1)));
+            *sift = std::move(tmp);
+            moved += cur - sift;
+        }
+        if (moved > partial_insertion_limit) return false;
+    }
+    return true;
+}
+
+template <typename T, typename Compare>
+void sort3(T *a, T *b, T *c, Compare &comp) {
+    if (comp(*b, *a)) std::iter_swap(a, b);
+    if (comp(*c, *b)) std::iter_swap(b, c);
+    if (comp(*b, *a)) std::iter_swap(a, b);
+}
+
+// Partitions around *begin, elements equal to the pivot go right. Returns the pivot position and
+// whether the range was already partitioned.
+template <typename T, typename Compare>
+std::pair<T *, bool> partition_right(T *begin, T *end, Compare &comp) {
+    T pivot(std::move(*begin));
+    T *first = begin, *last = end;
+    while (comp(*++first, pivot)) {
+    }
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot)) {
+        }
+    } else {
+        while (!comp(*--last, pivot)) {
+        }
+    }
+    bool already_partitioned = first >= last;
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (comp(*++first, pivot)) {
+        }
+        while (!comp(*--last, pivot)) {
+        }
+    }
+    T *pivot_pos = first - 1;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return {pivot_pos, already_partitioned};
+}
+
+// Partitions around *begin with equal elements on the left. Used when the pivot equals the
+// element before the range, then the whole left part is equal and needs no more sorting.
+template <typename T, typename Compare>
+T *partition_left(T *begin, T *end, Compare &comp) {
+    T pivot(std::move(*begin));
+    T *first = begin, *last = end;
+    while (comp(pivot, *--last)) {
+    }
+    if (last + 1 == end) {
+        while (first < last && !comp(pivot, *++first)) {
+        }
+    } else {
+        while (!comp(pivot, *++first)) {
+        }
+    }
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (comp(pivot, *--last)) {
+        }
+        while (!comp(pivot, *++first)) {
+        }
+    }
+    *begin = std::move(*last);
+    *last = std::move(pivot);
+    return last;
+}
+
+template <typename T, typename Compare>
+void sort_loop(T *begin, T *end, Compare &comp, int bad_allowed, bool leftmost) {
+    for (;;) {
+        size_t size = end - begin;
+        if (size < insertion_threshold) {
+            if (leftmost) {
+                insertion_sort<false>(begin, end, comp);
+            } else {
+                insertion_sort<true>(begin, end, comp);
+            }
+            return;
+        }
+
+        size_t half = size / 2;
+        if (size > ninther_threshold) {
+            sort3(begin, begin + half, end - 1, comp);
+            sort3(begin + 1, begin + (half - 1), end - 2, comp);
+            sort3(begin + 2, begin + (half + 1), end - 3, comp);
+            sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+            std::iter_swap(begin, begin + half);
+        } else {
+            sort3(begin + half, begin, end - 1, comp);
+        }
+
+        if (!leftmost && !comp(*(begin - 1), *begin)) {
+            begin = partition_left(begin, end, comp) + 1;
+            continue;
+        }
+
+        auto [pivot_pos, already_partitioned] = partition_right(begin, end, comp);
+        size_t left_size = pivot_pos - begin;
+        size_t right_size = end - (pivot_pos + 1);
+        if (left_size < size / 8 || right_size < size / 8) {
+            if (--bad_allowed == 0) {
+                std::make_heap(begin, end, comp);
+                std::sort_heap(begin, end, comp);
+                return;
+            }
+            // break up the pattern that produced the bad partition
+            if (left_size >= insertion_threshold) {
+                std::iter_swap(begin, begin + left_size / 4);
+                std::iter_swap(pivot_pos - 1, pivot_pos - left_size / 4);
+                if (left_size > ninther_threshold) {
+                    std::iter_swap(begin + 1, begin + (left_size / 4 + 1));
+                    std::iter_swap(begin + 2, begin + (left_size / 4 + 2));
+                    std::iter_swap(pivot_pos - 2, pivot_pos - (left_size / 4 + 1));
+                    std::iter_swap(pivot_pos - 3, pivot_pos - (left_size / 4 + 2));
+                }
+            }
+            if (right_size >= insertion_threshold) {
+                std::iter_swap(pivot_pos + 1, pivot_pos + (1 + right_size / 4));
+                std::iter_swap(end - 1, end - right_size / 4);
+                if (right_size > ninther_threshold) {
+                    std::iter_swap(pivot_pos + 2, pivot_pos + (2 + right_size / 4));
+                    std::iter_swap(pivot_pos + 3, pivot_pos + (3 + right_size / 4));
+                    std::iter_swap(end - 2, end - (1 + right_size / 4));
+                    std::iter_swap(end - 3, end - (2 + right_size / 4));
+                }
+            }
+        } else if (already_partitioned && partial_insertion_sort(begin, pivot_pos, comp) &&
+                   partial_insertion_sort(pivot_pos + 1, end, comp)) {
+            return;
+        }
+
+        sort_loop(begin, pivot_pos, comp, bad_allowed, leftmost);
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+template <typename T, typename Compare>
+void sort(T *begin, T *end, Compare &comp) {
+    size_t size = end - begin;
+    int bad_allowed = 1;
+    while (size >>= 1) ++bad_allowed;
+    sort_loop(begin, end, comp, bad_allowed, true);
+}
+}  // namespace pdq
+
+// Merges the sorted runs [bounds[k], bounds[k + 1]) pairwise until one is left. Each pair is cut
+// into segments of equal output length with merge path, so all threads work on every round.
+// Ties are taken from the left run, which keeps the merge stable.
+template <typename T, typename Compare>
+void merge_runs(T *data, size_t n, vector<size_t> bounds, Compare &comp,
+                parallel::thread_pool &pool) {
+    struct segment {
+        T *a, *a_end, *b, *b_end, *out;
+    };
+    std::unique_ptr<T[]> buffer(new T[n]);
+    T *src = data, *dst = buffer.get();
+
+    while (bounds.size() > 2) {
+        vector<segment> segments;
+        vector<size_t> merged;
+        merged.push_back(0);
+        for (size_t k = 0; k + 1 < bounds.size(); k += 2) {
+            T *a = src + bounds[k];
+            T *b = src + bounds[k + 1];  // an odd last run is merged with an empty one
+            T *b_end = src + (k + 2 < bounds.size() ? bounds[k + 2] : bounds[k + 1]);
+            size_t a_size = b - a, b_size = b_end - b;
+            size_t total = a_size + b_size;
+            size_t parts = std::max<size_t>(1, (pool.size() * total + n - 1) / n);
+            size_t prev_i = 0, prev_d = 0;
+            for (size_t part = 1; part <= parts; ++part) {
+                size_t d = total * part / parts;
+                size_t lo = d > b_size ? d - b_size : 0, hi = std::min(d, a_size);
+                while (lo < hi) {
+                    size_t i = lo + (hi - lo) / 2;
+                    if (!comp(b[d - i - 1], a[i])) {
+                        lo = i + 1;
+                    } else {
+                        hi = i;
+                    }
+                }
+                segments.push_back({a + prev_i, a + lo, b + (prev_d - prev_i), b + (d - lo),
+                                    dst + (a - src) + prev_d});
+                prev_i = lo;
+                prev_d = d;
+            }
+            merged.push_back(b_end - src);
+        }
+        pool.run(segments.size(), [&](size_t s) {
+            const segment &seg = segments[s];
+            std::merge(std::make_move_iterator(seg.a), std::make_move_iterator(seg.a_end),
+                       std::make_move_iterator(seg.b), std::make_move_iterator(seg.b_end), seg.out,
+                       comp);
+        });
+        bounds = std::move(merged);
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        parallel::detail::partition chunks =
+            parallel::detail::make_partition(data, n, pool.size());
+        pool.run(chunks.count, [&](size_t chunk) {
+            std::move(src + chunks.begin(chunk), src + chunks.end(chunk),
+                      data + chunks.begin(chunk));
+        });
+    }
+}
+
+template <bool Stable, typename T, typename Compare>
+void sort(T *data, size_t n, Compare comp, parallel::thread_pool &pool) {
+    if constexpr (radix_order<T, Compare>::sortable) {
+        if (n > 64) {
+            radix_sort<radix_order<T, Compare>::descending>(data, n, pool);
+            return;
+        }
+    }
+    bool parallel_runs = n >= parallel_sort_threshold && pool.size() > 1;
+    if constexpr (std::is_default_constructible_v<T>) {
+        if (parallel_runs) {
+            // one run per thread, sorted in parallel and merged
+            size_t runs = pool.size();
+            vector<size_t> bounds;
+            for (size_t k = 0; k <= runs; ++k) bounds.push_back(n * k / runs);
+            pool.run(runs, [&](size_t k) {
+                if constexpr (Stable) {
+                    std::stable_sort(data + bounds[k], data + bounds[k + 1], comp);
+                } else {
+                    pdq::sort(data + bounds[k], data + bounds[k + 1], comp);
+                }
+            });
+            merge_runs(data, n, std::move(bounds), comp, pool);
+            return;
+        }
+    }
+    if constexpr (Stable) {
+        std::stable_sort(data, data + n, comp);
+    } else {
+        pdq::sort(data, data + n, comp);
+    }
+}
+}  // namespace detail
+
+// Sorts the elements with comp. Runs in parallel on pool for large containers.
+template <typename Container, typename Compare = std::less<>>
+void sort(Container &container, Compare comp = Compare(),
+          parallel::thread_pool &pool = parallel::default_pool()) {
+    detail::sort<false>(container.data(), container.size(), comp, pool);
+}
+
+// Sorts the elements with comp keeping equivalent elements in their original order.
+template <typename Container, typename Compare = std::less<>>
+void stable_sort(Container &container, Compare comp = Compare(),
+                 parallel::thread_pool &pool = parallel::default_pool()) {
+    detail::sort<true>(container.data(), container.size(), comp, pool);
+}
+}  // namespace containers
+
+#endif
@@ -0,0 +1,249 @@
+#ifndef CONTAINERS_SPSC_QUEUE
+#define CONTAINERS_SPSC_QUEUE
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "cache_line.h"
+
+namespace containers {
+// Bounded FIFO for exactly one producer thread and one consumer thread. Neither side takes a lock
+// or waits for the other: push and pop finish in a bounded number of steps. Only the producer may
+// call the push functions and only the consumer the pop functions and front(); empty() and size()
+// may be called from either side and are exact only when the other side is idle.
+//
+// The positions are free-running counters masked into a power-of-two ring. Each side keeps a copy
+// of the other side's counter and rereads the shared one only when the copy says the ring is full
+// (or empty), so in the steady state a push or pop touches no cache line the other thread writes.
+template <typename T, typename Allocator = std::allocator<T>>
+class spsc_queue {
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+   private:
+    // written by nobody after construction
+    struct alignas(cache_line_size) shared_state {
+        T *data_;
+        size_type mask_;
+        Allocator allocator_;
+    };
+    // written by the producer
+    struct alignas(cache_line_size) producer_state {
+        std::atomic<size_type> tail_{0};
+        size_type head_cache_ = 0;
+    };
+    // written by the consumer
+    struct alignas(cache_line_size) consumer_state {
+        std::atomic<size_type> head_{0};
+        size_type tail_cache_ = 0;
+    };
+
+    shared_state ring_;
+    producer_state producer_;
+    consumer_state consumer_;
+
+    T *slot(size_type position) const noexcept { return ring_.data_ + (position & ring_.mask_); }
+    // free slots as seen by the producer, rereads the consumer position when `wanted` do not fit
+    size_type free_slots(size_type tail, size_type wanted) noexcept;
+    // filled slots as seen by the consumer, rereads the producer position when `wanted` are missing
+    size_type filled_slots(size_type head, size_type wanted) noexcept;
+
+   public:
+    // Spsc queue Member functions
+    explicit spsc_queue(size_type capacity);
+    spsc_queue(const spsc_queue &) = delete;
+    spsc_queue &operator=(const spsc_queue &) = delete;
+    ~spsc_queue();
+
+    // Spsc queue Capacity
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+
+    // Spsc queue Producer
+    template <typename... Args>
+    bool try_emplace(Args &&...args);
+    bool try_push(const_reference value);
+    bool try_push(value_type &&value);
+    // Copies up to n elements from first and returns how many fit, they become visible together.
+    template <typename InputIt>
+    size_type try_push_n(InputIt first, size_type n);
+    // Spins, yielding the thread, until the element fits.
+    void push(const_reference value);
+    void push(value_type &&value);
+
+    // Spsc queue Consumer
+    // The oldest element, the queue must not be empty.
+    reference front() noexcept;
+    // Removes the oldest element, the queue must not be empty.
+    void pop() noexcept;
+    bool try_pop(reference value);
+    // Moves up to n elements to out and returns how many there were.
+    template <typename OutputIt>
+    size_type try_pop_n(OutputIt out, size_type n);
+};
+}  // namespace containers
+
+template <typename T, typename Allocator>
+containers::spsc_queue<T, Allocator>::spsc_queue(size_type capacity) {
+    if (capacity == 0 || capacity > (size_type(1) << (std::numeric_limits<size_type>::digits - 2))) {
+        throw std::length_error("length_error");
+    }
+    size_type rounded = 1;
+    while (rounded < capacity) rounded *= 2;
+    ring_.data_ = ring_.allocator_.allocate(rounded);
+    ring_.mask_ = rounded - 1;
+}
+
+template <typename T, typename Allocator>
+containers::spsc_queue<T, Allocator>::~spsc_queue() {
+    size_type head = consumer_.head_.load(std::memory_order_relaxed);
+    size_type tail = producer_.tail_.load(std::memory_order_acquire);
+    for (; head != tail; ++head) slot(head)->~T();
+    ring_.allocator_.deallocate(ring_.data_, ring_.mask_ + 1);
+}
+
+template <typename T, typename Allocator>
+bool containers::spsc_queue<T, Allocator>::empty() const noexcept {
+    return size() == 0;
+}
+
+template <typename T, typename Allocator>
+size_t containers::spsc_queue<T, Allocator>::size() const noexcept {
+    // the head is read first, so the difference cannot be negative
+    size_type head = consumer_.head_.load(std::memory_order_acquire);
+    size_type tail = producer_.tail_.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+template <typename T, typename Allocator>
+size_t containers::spsc_queue<T, Allocator>::capacity() const noexcept {
+    return ring_.mask_ + 1;
+}
+
+template <typename T, typename Allocator>
+size_t containers::spsc_queue<T, Allocator>::free_slots(size_type tail, size_type wanted) noexcept {
+    size_type available = capacity() - (tail - producer_.head_cache_);
+    if (available < wanted) {
+        producer_.head_cache_ = consumer_.head_.load(std::memory_order_acquire);
+        available = capacity() - (tail - producer_.head_cache_);
+    }
+    return available;
+}
+
+template <typename T, typename Allocator>
+size_t containers::spsc_queue<T, Allocator>::filled_slots(size_type head,
+                                                         size_type wanted) noexcept {
+    size_type available = consumer_.tail_cache_ - head;
+    if (available < wanted) {
+        consumer_.tail_cache_ = producer_.tail_.load(std::memory_order_acquire);
+        available = consumer_.tail_cache_ - head;
+    }
+    return available;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+bool containers::spsc_queue<T, Allocator>::try_emplace(Args &&...args) {
+    size_type tail = producer_.tail_.load(std::memory_order_relaxed);
+    if (free_slots(tail, 1) == 0) return false;
+    ::new (static_cast<void *>(slot(tail))) T(std::forward<Args>(args)...);
+    producer_.tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+bool containers::spsc_queue<T, Allocator>::try_push(const_reference value) {
+    return try_emplace(value);
+}
+
+template <typename T, typename Allocator>
+bool containers::spsc_queue<T, Allocator>::try_push(value_type &&value) {
+    return try_emplace(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+size_t containers::spsc_queue<T, Allocator>::try_push_n(InputIt first, size_type n) {
+    size_type tail = producer_.tail_.load(std::memory_order_relaxed);
+    size_type count = free_slots(tail, n);
+    if (count > n) count = n;
+    size_type done = 0;
+    try {
+        for (; done < count; ++done, ++first) ::new (static_cast<void *>(slot(tail + done))) T(*first);
+    } catch (...) {
+        // the elements built so far are complete, hand them over
+        producer_.tail_.store(tail + done, std::memory_order_release);
+        throw;
+    }
+    producer_.tail_.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+template <typename T, typename Allocator>
+void containers::spsc_queue<T, Allocator>::push(const_reference value) {
+    while (!try_emplace(value)) std::this_thread::yield();
+}
+
+template <typename T, typename Allocator>
+void containers::spsc_queue<T, Allocator>::push(value_type &&value) {
+    // try_emplace only moves from value once there is room
+    while (!try_emplace(std::move(value))) std::this_thread::yield();
+}
+
+template <typename T, typename Allocator>
+typename containers::spsc_queue<T, Allocator>::reference
+containers::spsc_queue<T, Allocator>::front() noexcept {
+    return *slot(consumer_.head_.load(std::memory_order_relaxed));
+}
+
+template <typename T, typename Allocator>
+void containers::spsc_queue<T, Allocator>::pop() noexcept {
+    size_type head = consumer_.head_.load(std::memory_order_relaxed);
+    slot(head)->~T();
+    // the element was there, so the producer is at least one past it; keeps the cache behind it
+    if (consumer_.tail_cache_ == head) consumer_.tail_cache_ = head + 1;
+    consumer_.head_.store(head + 1, std::memory_order_release);
+}
+
+template <typename T, typename Allocator>
+bool containers::spsc_queue<T, Allocator>::try_pop(reference value) {
+    size_type head = consumer_.head_.load(std::memory_order_relaxed);
+    if (filled_slots(head, 1) == 0) return false;
+    T *item = slot(head);
+    value = std::move(*item);
+    item->~T();
+    consumer_.head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+template <typename OutputIt>
+size_t containers::spsc_queue<T, Allocator>::try_pop_n(OutputIt out, size_type n) {
+    size_type head = consumer_.head_.load(std::memory_order_relaxed);
+    size_type count = filled_slots(head, n);
+    if (count > n) count = n;
+    size_type done = 0;
+    try {
+        for (; done < count; ++done, ++out) {
+            T *item = slot(head + done);
+            *out = std::move(*item);
+            item->~T();
+        }
+    } catch (...) {
+        // the element that failed to move stays in the queue
+        consumer_.head_.store(head + done, std::memory_order_release);
+        throw;
+    }
+    consumer_.head_.store(head + count, std::memory_order_release);
+    return count;
+}
+
+#endif
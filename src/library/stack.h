@@ -2,6 +2,7 @@
 #define CONTAINERS_STACK
 
 #include <cstddef>
+#include <utility>
 
 #include "vector.h"
 
@@ -26,6 +27,7 @@ class stack {
     ~stack();
 
     // Stack Element access
+    reference top() noexcept;
     const_reference top() const noexcept;
 
     // Stack Capacity
@@ -34,6 +36,9 @@ class stack {
 
     // Stack Modifiers
     void push(const_reference value) noexcept;
+    void push(value_type &&value);
+    template <typename... Args>
+    reference emplace(Args &&...args);
     void pop() noexcept;
     void swap(stack &other) noexcept;
 };
@@ -44,8 +49,7 @@ containers::stack<T, _container>::stack() {}
 
 template <typename T, typename _container>
 containers::stack<T, _container>::stack(std::initializer_list<T> const &items) {
-    for (T i : items) push(i);
-    stack_.print();
+    for (auto &item : items) push(item);
 }
 
 template <typename T, typename _container>
@@ -65,6 +69,11 @@ containers::stack<T, _container> &containers::stack<T, _container>::operator=(st
 template <typename T, typename _container>
 containers::stack<T, _container>::~stack() {}
 
+template <typename T, typename _container>
+typename containers::stack<T, _container>::reference containers::stack<T, _container>::top() noexcept {
+    return stack_.back();
+}
+
 template <typename T, typename _container>
 typename containers::stack<T, _container>::const_reference containers::stack<T, _container>::top() const noexcept {
     return stack_.back();
@@ -90,6 +99,18 @@ void containers::stack<T, _container>::push(const_reference value) noexcept {
     stack_.push_back(value);
 }
 
+template <typename T, typename _container>
+void containers::stack<T, _container>::push(value_type &&value) {
+    stack_.push_back(std::move(value));
+}
+
+template <typename T, typename _container>
+template <typename... Args>
+typename containers::stack<T, _container>::reference containers::stack<T, _container>::emplace(
+    Args &&...args) {
+    return stack_.emplace_back(std::forward<Args>(args)...);
+}
+
 template <typename T, typename _container>
 void containers::stack<T, _container>::swap(stack &other) noexcept {
     std::swap(stack_, other.stack_);
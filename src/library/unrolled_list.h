@@ -0,0 +1,609 @@
+#ifndef CONTAINERS_UNROLLED_LIST
+#define CONTAINERS_UNROLLED_LIST
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "node_pool.h"
+#include "relocate.h"
+
+namespace containers {
+namespace detail {
+// Default number of elements per unrolled_list node, about half a kilobyte of elements.
+template <typename T>
+inline constexpr size_t unrolled_capacity = sizeof(T) * 4 >= 512 ? 4 : 512 / sizeof(T);
+}  // namespace detail
+
+// Doubly linked list of nodes that each hold up to B elements in an inline array. Iteration walks
+// arrays instead of chasing a pointer per element. insert and erase shift at most B elements and
+// invalidate the iterators to the elements of the nodes they change.
+template <typename T, size_t B = detail::unrolled_capacity<T>, typename Allocator = std::allocator<T>>
+class unrolled_list {
+    static_assert(B > 1, "unrolled_list nodes need room for at least two elements");
+
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+   private:
+    struct node_base {
+        node_base *prev_;
+        node_base *next_;
+        size_type count_;
+    };
+    struct node : node_base {
+        alignas(T) unsigned char storage_[B * sizeof(T)];
+
+        T *data() noexcept { return reinterpret_cast<T *>(storage_); }
+    };
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+
+    // Ring of nodes closed by end_, which holds no elements.
+    size_type size_ = 0;
+    node_base end_{&end_, &end_, 0};
+    node_allocator allocator_;
+
+    static T *data(node_base *ptr) noexcept { return static_cast<node *>(ptr)->data(); }
+    node *create_node(node_base *pos);
+    void destroy_node(node_base *ptr) noexcept;
+    // moves the elements [at, count) of ptr into a new node that follows it
+    node *split(node_base *ptr, size_type at);
+    void steal(unrolled_list &other) noexcept;
+    static void link(node_base *pos, node_base *first, node_base *last) noexcept;
+    static void unlink(node_base *first, node_base *last) noexcept;
+
+   public:
+    class iterator {
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        iterator(node_base *ptr = nullptr, size_type index = 0) : ptr_(ptr), index_(index) {}
+
+        reference operator*() const { return data(ptr_)[index_]; }
+        pointer operator->() const { return data(ptr_) + index_; }
+
+        iterator &operator++() {
+            if (++index_ == ptr_->count_) {
+                ptr_ = ptr_->next_;
+                index_ = 0;
+            }
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator result = *this;
+            ++*this;
+            return result;
+        }
+        iterator &operator--() {
+            if (index_ == 0) {
+                ptr_ = ptr_->prev_;
+                index_ = ptr_->count_;
+            }
+            --index_;
+            return *this;
+        }
+        iterator operator--(int) {
+            iterator result = *this;
+            --*this;
+            return result;
+        }
+        bool operator==(const iterator &other) const {
+            return ptr_ == other.ptr_ && index_ == other.index_;
+        }
+        bool operator!=(const iterator &other) const { return !(*this == other); }
+        node_base *get_ptr() const { return ptr_; }
+        size_type get_index() const { return index_; }
+
+       private:
+        node_base *ptr_;
+        size_type index_;
+    };
+
+    class const_iterator {
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator(const node_base *ptr = nullptr, size_type index = 0)
+            : ptr_(ptr), index_(index) {}
+        const_iterator(const iterator &other) : ptr_(other.get_ptr()), index_(other.get_index()) {}
+
+        reference operator*() const { return data(get_ptr())[index_]; }
+        pointer operator->() const { return data(get_ptr()) + index_; }
+
+        const_iterator &operator++() {
+            if (++index_ == ptr_->count_) {
+                ptr_ = ptr_->next_;
+                index_ = 0;
+            }
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator result = *this;
+            ++*this;
+            return result;
+        }
+        const_iterator &operator--() {
+            if (index_ == 0) {
+                ptr_ = ptr_->prev_;
+                index_ = ptr_->count_;
+            }
+            --index_;
+            return *this;
+        }
+        const_iterator operator--(int) {
+            const_iterator result = *this;
+            --*this;
+            return result;
+        }
+        friend bool operator==(const const_iterator &left, const const_iterator &right) {
+            return left.ptr_ == right.ptr_ && left.index_ == right.index_;
+        }
+        friend bool operator!=(const const_iterator &left, const const_iterator &right) {
+            return !(left == right);
+        }
+        // the list owns the node, so a list method may modify it through a const_iterator
+        node_base *get_ptr() const { return const_cast<node_base *>(ptr_); }
+        size_type get_index() const { return index_; }
+
+       private:
+        const node_base *ptr_;
+        size_type index_;
+    };
+
+    // Unrolled list Functions
+    unrolled_list();
+    explicit unrolled_list(const Allocator &allocator);
+    unrolled_list(size_type n);
+    unrolled_list(std::initializer_list<T> const &items);
+    unrolled_list(const unrolled_list &other);
+    unrolled_list(unrolled_list &&other);
+    unrolled_list &operator=(unrolled_list &&other);
+    unrolled_list &operator=(std::initializer_list<T> const &items);
+    ~unrolled_list();
+
+    Allocator get_allocator() const { return Allocator(allocator_); }
+
+    // Unrolled list Element access
+    const_reference front() const;
+    const_reference back() const;
+
+    // Unrolled list Iterators
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    // Unrolled list Capacity
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type max_size() const noexcept;
+    static constexpr size_type node_capacity() noexcept { return B; }
+
+    // Unrolled list Modifiers
+    void clear();
+    iterator insert(const_iterator pos, const_reference value);
+    iterator insert(const_iterator pos, value_type &&value);
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    void push_back(const_reference value);
+    void push_back(value_type &&value);
+    void push_front(const_reference value);
+    void push_front(value_type &&value);
+    void pop_back();
+    void pop_front();
+    void swap(unrolled_list &other);
+    void splice(const_iterator pos, unrolled_list &other);
+};
+}  // namespace containers
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator>::unrolled_list() {}
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator>::unrolled_list(const Allocator &allocator)
+    : allocator_(allocator) {}
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator>::unrolled_list(size_type n) {
+    for (size_type i = 0; i < n; ++i) emplace(end());
+}
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator>::unrolled_list(std::initializer_list<T> const &items) {
+    for (auto &item : items) push_back(item);
+}
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator>::unrolled_list(const unrolled_list &other)
+    : allocator_(std::allocator_traits<node_allocator>::select_on_container_copy_construction(
+          other.allocator_)) {
+    for (auto &item : other) push_back(item);
+}
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator>::unrolled_list(unrolled_list &&other)
+    : allocator_(other.allocator_) {
+    steal(other);
+}
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator> &containers::unrolled_list<T, B, Allocator>::operator=(
+    unrolled_list &&other) {
+    if (this == &other) return *this;
+    clear();
+    if constexpr (!std::allocator_traits<
+                      node_allocator>::propagate_on_container_move_assignment::value) {
+        if (allocator_ != other.allocator_) {
+            // the nodes of other cannot be freed through this allocator, move the values instead
+            for (auto &item : other) push_back(std::move(item));
+            other.clear();
+            return *this;
+        }
+    } else {
+        allocator_ = std::move(other.allocator_);
+    }
+    steal(other);
+    return *this;
+}
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator> &containers::unrolled_list<T, B, Allocator>::operator=(
+    std::initializer_list<T> const &items) {
+    clear();
+    for (auto &item : items) push_back(item);
+    return *this;
+}
+
+template <typename T, size_t B, typename Allocator>
+containers::unrolled_list<T, B, Allocator>::~unrolled_list() {
+    clear();
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::node *
+containers::unrolled_list<T, B, Allocator>::create_node(node_base *pos) {
+    // the new empty node is linked in front of pos
+    node *ptr = allocator_.allocate(1);
+    // default initialisation leaves the element storage untouched
+    ::new (static_cast<void *>(ptr)) node;
+    ptr->count_ = 0;
+    link(pos, ptr, ptr);
+    return ptr;
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::destroy_node(node_base *ptr) noexcept {
+    // the node must be unlinked already
+    node *full = static_cast<node *>(ptr);
+    detail::destroy(full->data(), full->count_);
+    full->~node();
+    allocator_.deallocate(full, 1);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::node *
+containers::unrolled_list<T, B, Allocator>::split(node_base *ptr, size_type at) {
+    node *upper = create_node(ptr->next_);
+    try {
+        detail::relocate(data(ptr) + at, ptr->count_ - at, upper->data());
+    } catch (...) {
+        unlink(upper, upper);
+        destroy_node(upper);
+        throw;
+    }
+    upper->count_ = ptr->count_ - at;
+    ptr->count_ = at;
+    return upper;
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::steal(unrolled_list &other) noexcept {
+    // this list must be empty, the allocators must be equal
+    if (other.size_ == 0) return;
+    link(&end_, other.end_.next_, other.end_.prev_);
+    size_ = other.size_;
+    other.end_.prev_ = other.end_.next_ = &other.end_;
+    other.size_ = 0;
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::link(node_base *pos, node_base *first,
+                                                      node_base *last) noexcept {
+    first->prev_ = pos->prev_;
+    last->next_ = pos;
+    pos->prev_->next_ = first;
+    pos->prev_ = last;
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::unlink(node_base *first, node_base *last) noexcept {
+    first->prev_->next_ = last->next_;
+    last->next_->prev_ = first->prev_;
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::iterator
+containers::unrolled_list<T, B, Allocator>::begin() noexcept {
+    return iterator(end_.next_, 0);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::const_iterator
+containers::unrolled_list<T, B, Allocator>::begin() const noexcept {
+    return const_iterator(end_.next_, 0);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::const_iterator
+containers::unrolled_list<T, B, Allocator>::cbegin() const noexcept {
+    return const_iterator(end_.next_, 0);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::iterator
+containers::unrolled_list<T, B, Allocator>::end() noexcept {
+    return iterator(&end_, 0);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::const_iterator
+containers::unrolled_list<T, B, Allocator>::end() const noexcept {
+    return const_iterator(&end_, 0);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::const_iterator
+containers::unrolled_list<T, B, Allocator>::cend() const noexcept {
+    return const_iterator(&end_, 0);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::const_reference
+containers::unrolled_list<T, B, Allocator>::front() const {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    return *begin();
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::const_reference
+containers::unrolled_list<T, B, Allocator>::back() const {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    return *--end();
+}
+
+template <typename T, size_t B, typename Allocator>
+bool containers::unrolled_list<T, B, Allocator>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T, size_t B, typename Allocator>
+size_t containers::unrolled_list<T, B, Allocator>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, size_t B, typename Allocator>
+size_t containers::unrolled_list<T, B, Allocator>::max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(T) / 2;
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::clear() {
+    node_base *curr = end_.next_;
+    while (curr != &end_) {
+        node_base *next = curr->next_;
+        destroy_node(curr);
+        curr = next;
+    }
+    size_ = 0;
+    end_.prev_ = end_.next_ = &end_;
+    detail::release(allocator_);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::iterator
+containers::unrolled_list<T, B, Allocator>::insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::iterator
+containers::unrolled_list<T, B, Allocator>::insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, size_t B, typename Allocator>
+template <typename... Args>
+typename containers::unrolled_list<T, B, Allocator>::iterator
+containers::unrolled_list<T, B, Allocator>::emplace(const_iterator pos, Args &&...args) {
+    // the arguments may refer to elements that are about to be shifted
+    T temp(std::forward<Args>(args)...);
+    node_base *target = pos.get_ptr();
+    size_type index = pos.get_index();
+    if (index == 0 && target->prev_ != &end_ && target->prev_->count_ < B) {
+        // appending to the node in front is cheaper than shifting the elements of this one
+        target = target->prev_;
+        index = target->count_;
+    } else if (target == &end_ || target->count_ == B) {
+        if (target == &end_) {
+            target = create_node(&end_);
+        } else {
+            node *upper = split(target, B / 2);
+            if (index >= B / 2) {
+                target = upper;
+                index -= B / 2;
+            }
+        }
+    }
+    T *slots = data(target);
+    if constexpr (!detail::is_nothrow_relocatable_v<T>) {
+        if (index != target->count_) {
+            // a throw must leave every slot alive: open the last slot by copying the last
+            // element, then shift by assignment like std::vector::insert
+            ::new (static_cast<void *>(slots + target->count_))
+                T(std::move_if_noexcept(slots[target->count_ - 1]));
+            ++target->count_;
+            ++size_;
+            std::move_backward(slots + index, slots + target->count_ - 2,
+                               slots + target->count_ - 1);
+            slots[index] = std::move(temp);
+            return iterator(target, index);
+        }
+    }
+    detail::relocate_overlapping(slots + index, target->count_ - index, slots + index + 1);
+    try {
+        ::new (static_cast<void *>(slots + index)) T(std::move(temp));
+    } catch (...) {
+        detail::relocate_overlapping(slots + index + 1, target->count_ - index, slots + index);
+        if (target->count_ == 0) {
+            unlink(target, target);
+            destroy_node(target);
+        }
+        throw;
+    }
+    ++target->count_;
+    ++size_;
+    return iterator(target, index);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::iterator
+containers::unrolled_list<T, B, Allocator>::erase(const_iterator pos) {
+    if (pos == end()) {
+        throw std::out_of_range("out_of_range");
+    }
+    node_base *target = pos.get_ptr();
+    size_type index = pos.get_index();
+    T *slots = data(target);
+    detail::erase_shift(slots + index, target->count_ - index);
+    --target->count_;
+    --size_;
+
+    node_base *next = target->next_;
+    if (target->count_ == 0) {
+        unlink(target, target);
+        destroy_node(target);
+        return iterator(next, 0);
+    }
+    // Keep the nodes at least a quarter full on average by folding the next one in. Folding is
+    // skipped for elements that may throw while moved, erase has already succeeded.
+    if (detail::is_nothrow_relocatable_v<T> && next != &end_ &&
+        target->count_ + next->count_ <= B / 2) {
+        detail::relocate(data(next), next->count_, slots + target->count_);
+        target->count_ += next->count_;
+        next->count_ = 0;
+        unlink(next, next);
+        destroy_node(next);
+    }
+    if (index < target->count_) return iterator(target, index);
+    return iterator(target->next_, 0);
+}
+
+template <typename T, size_t B, typename Allocator>
+typename containers::unrolled_list<T, B, Allocator>::iterator
+containers::unrolled_list<T, B, Allocator>::erase(const_iterator first, const_iterator last) {
+    // erasing may move the elements behind first, so the range is counted up front
+    size_type count = 0;
+    for (const_iterator it = first; it != last; ++it) ++count;
+    iterator result(first.get_ptr(), first.get_index());
+    for (; count > 0; --count) result = erase(result);
+    return result;
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::push_back(const_reference value) {
+    emplace(end(), value);
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::push_back(value_type &&value) {
+    emplace(end(), std::move(value));
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::push_front(const_reference value) {
+    emplace(begin(), value);
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::push_front(value_type &&value) {
+    emplace(begin(), std::move(value));
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    erase(--end());
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("out_of_range");
+    }
+    erase(begin());
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::swap(unrolled_list &other) {
+    if (this == &other) return;
+    // each end_ stays in its list, the rings of nodes change places
+    node_base *first = end_.next_;
+    node_base *last = end_.prev_;
+    size_type count = size_;
+    end_.prev_ = end_.next_ = &end_;
+    size_ = 0;
+    steal(other);
+    if (count) link(&other.end_, first, last);
+    other.size_ = count;
+    std::swap(allocator_, other.allocator_);
+}
+
+template <typename T, size_t B, typename Allocator>
+void containers::unrolled_list<T, B, Allocator>::splice(const_iterator pos, unrolled_list &other) {
+    if (this == &other || other.empty()) return;
+    if (allocator_ != other.allocator_) {
+        // nodes cannot change owner between allocators that do not share memory
+        iterator it(pos.get_ptr(), pos.get_index());
+        for (auto &item : other) {
+            it = emplace(it, std::move(item));
+            ++it;
+        }
+        other.clear();
+        return;
+    }
+    // whole nodes move over, a node split at pos is the only element move
+    node_base *target = pos.get_ptr();
+    if (pos.get_index() != 0) target = split(target, pos.get_index());
+    node_base *first = other.end_.next_;
+    node_base *last = other.end_.prev_;
+    unlink(first, last);
+    link(target, first, last);
+    size_ += other.size_;
+    other.size_ = 0;
+}
+
+#endif
@@ -1,13 +1,21 @@
 #ifndef CONTAINERS_VECTOR
 #define CONTAINERS_VECTOR
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
+
+#include "bounds_check.h"
+#include "growth_policy.h"
+#include "iterator.h"
+#include "relocate.h"
 
 namespace containers {
-template <typename T, typename Allocator = std::allocator<T>>
+template <typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = doubling_growth>
 class vector {
     using size_type = size_t;
     using value_type = T;
@@ -20,32 +28,16 @@ class vector {
     size_type capacity_;
     Allocator allocator_;
 
+    size_type recommended_capacity(size_type required) const noexcept;
+    template <typename Construct>
+    void insert_gap(size_type index, size_type count, Construct construct);
+    // true when arg is one of the elements, which insert_gap may relocate before it is read
+    template <typename U>
+    bool holds(const U &arg) const noexcept;
+
    public:
-    // Iterator
-    class iterator {
-       private:
-        T *ptr_;
-
-       public:
-        iterator(T *ptr) : ptr_(ptr) {}
-        reference operator*() const { return *ptr_; }  // vector<int>::iterator iter = vec1.begin(); *iter;
-        iterator &operator++() {
-            ++ptr_;
-            return *this;
-        }
-        iterator &operator--() {
-            --ptr_;
-            return *this;
-        }
-        iterator operator+(std::ptrdiff_t n) { return iterator(ptr_ + n); }
-        iterator operator-(std::ptrdiff_t n) { return iterator(ptr_ - n); }
-        bool operator>(const iterator &other) const { return ptr_ > other.ptr_; }
-        bool operator>=(const iterator &other) const { return ptr_ >= other.ptr_; }
-        bool operator<(const iterator &other) const { return ptr_ < other.ptr_; }
-        bool operator==(const iterator &other) const { return ptr_ == other.ptr_; }
-        bool operator!=(const iterator &other) const { return ptr_ != other.ptr_; }
-        T *get_ptr() { return ptr_; }
-    };
+    using iterator = contiguous_iterator<T>;
+    using const_iterator = contiguous_iterator<const T>;
 
     // Vector Member functions
     vector();
@@ -59,13 +51,21 @@ class vector {
 
     // Vector Element access
     reference at(size_type pos);
-    reference operator[](size_type pos);
+    const_reference at(size_type pos) const;
+    reference operator[](size_type pos) noexcept;
+    const_reference operator[](size_type pos) const noexcept;
     reference front() const;
     reference back() const;
+    T *data() noexcept;
+    const T *data() const noexcept;
 
     // Vector Iterators
-    iterator begin() const noexcept;
-    iterator end() const noexcept;
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
 
     // Vector Capacity
     bool empty() const noexcept;
@@ -77,15 +77,31 @@ class vector {
 
     // Vector Modifiers
     void clear();
-    iterator insert(iterator pos, const_reference value);
+    iterator insert(const_iterator pos, const_reference value);
+    iterator insert(const_iterator pos, value_type &&value);
+    template <typename InputIt, typename = std::enable_if_t<detail::is_iterator_v<InputIt>>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+    iterator erase(const_iterator pos);
     void push_back(const_reference value);
-    void push_back(reference &value);
+    void push_back(value_type &&value);
     void pop_back();
     void swap(vector &other);
 
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+
+    template <typename... Args>
+    reference emplace_back(Args &&...args);
+
+    template <typename InputIt, typename = std::enable_if_t<detail::is_iterator_v<InputIt>>>
+    void assign(InputIt first, InputIt last);
+
+    template <typename Range>
+    void append_range(const Range &range);
+
     // Bonus
     template <typename... Args>
-    iterator insert_many(iterator pos, Args &&...args);
+    iterator insert_many(const_iterator pos, Args &&...args);
 
     template <typename... Args>
     void insert_many_back(Args &&...args);
@@ -98,66 +114,68 @@ class vector {
 };
 }  // namespace containers
 
-template <typename T, typename Allocator>
-containers::vector<T, Allocator>::vector() {
+template <typename T, typename Allocator, typename GrowthPolicy>
+containers::vector<T, Allocator, GrowthPolicy>::vector() {
     size_ = 0;
     capacity_ = 0;
     data_ = nullptr;
 }
 
-template <typename T, typename Allocator>
-containers::vector<T, Allocator>::vector(std::ptrdiff_t n) : size_(n), capacity_(n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+containers::vector<T, Allocator, GrowthPolicy>::vector(std::ptrdiff_t n) : size_(n), capacity_(n) {
     if (n < 0) {
         throw std::length_error("length_error");
     }
     data_ = allocator_.allocate(n);
+    std::uninitialized_value_construct_n(data_, n);
 }
 
-template <typename T, typename Allocator>
-containers::vector<T, Allocator>::vector(const std::initializer_list<T> &items) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+containers::vector<T, Allocator, GrowthPolicy>::vector(const std::initializer_list<T> &items) {
     size_ = items.size();
     capacity_ = size_;
     data_ = allocator_.allocate(size_);
     std::uninitialized_copy(items.begin(), items.end(), data_);
 }
 
-template <typename T, typename Allocator>
-containers::vector<T, Allocator>::vector(const vector &other) : size_(other.size_), capacity_(other.capacity_) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+containers::vector<T, Allocator, GrowthPolicy>::vector(const vector &other)
+    : size_(other.size_), capacity_(other.size_) {
     data_ = allocator_.allocate(capacity_);
-    std::memcpy(data_, other.data_, capacity_ * sizeof(T));
+    std::uninitialized_copy(other.data_, other.data_ + size_, data_);
 }
 
-template <typename T, typename Allocator>
-containers::vector<T, Allocator>::vector(vector &&other)
+template <typename T, typename Allocator, typename GrowthPolicy>
+containers::vector<T, Allocator, GrowthPolicy>::vector(vector &&other)
     : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
     other.size_ = 0;
     other.capacity_ = 0;
     other.data_ = nullptr;
 }
 
-template <typename T, typename Allocator>
-containers::vector<T, Allocator> &containers::vector<T, Allocator>::operator=(const vector &right) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+containers::vector<T, Allocator, GrowthPolicy> &containers::vector<T, Allocator, GrowthPolicy>::operator=(
+    const vector &right) {
     if (this != &right) {
-        allocator_.deallocate(data_, capacity_);
-        for (size_type i = 0; i < size_; i++) {
-            (data_ + i)->~T();  // (*(data_ + i)).~T();
+        detail::destroy(data_, size_);
+        if (data_) {
+            allocator_.deallocate(data_, capacity_);
         }
         size_ = right.size_;
-        capacity_ = right.capacity_;
+        capacity_ = right.size_;
         data_ = allocator_.allocate(size_);
-        for (size_type i = 0; i < size_; i++) {
-            data_[i] = right.data_[i];
-        }
+        std::uninitialized_copy(right.data_, right.data_ + size_, data_);
     }
     return *this;
 }
 
-template <typename T, typename Allocator>
-containers::vector<T, Allocator> &containers::vector<T, Allocator>::operator=(vector &&right) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+containers::vector<T, Allocator, GrowthPolicy> &containers::vector<T, Allocator, GrowthPolicy>::operator=(
+    vector &&right) {
     if (this != &right) {
-        allocator_.deallocate(data_, capacity_);
-        for (size_type i = 0; i < size_; i++) {  // for a vector of vectors
-            (data_ + i)->~T();
+        detail::destroy(data_, size_);  // for a vector of vectors
+        if (data_) {
+            allocator_.deallocate(data_, capacity_);
         }
         size_ = right.size_;
         capacity_ = right.capacity_;
@@ -169,88 +187,161 @@ containers::vector<T, Allocator> &containers::vector<T, Allocator>::operator=(ve
     return *this;
 }
 
-template <typename T, typename Allocator>
-containers::vector<T, Allocator>::~vector() {
+template <typename T, typename Allocator, typename GrowthPolicy>
+containers::vector<T, Allocator, GrowthPolicy>::~vector() {
+    detail::destroy(data_, size_);
     if (data_) {
         allocator_.deallocate(data_, capacity_);
     }
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::reference containers::vector<T, Allocator>::at(size_type pos) {
-    if (pos >= size_ || pos < 0) throw std::out_of_range("out_of_range");
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::reference
+containers::vector<T, Allocator, GrowthPolicy>::at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return data_[pos];
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::const_reference
+containers::vector<T, Allocator, GrowthPolicy>::at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("out_of_range");
+    return data_[pos];
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::reference
+containers::vector<T, Allocator, GrowthPolicy>::operator[](size_type pos) noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
     return data_[pos];
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::reference containers::vector<T, Allocator>::operator[](size_type pos) {
-    // vec[pos] -> vec.operator[](pos) -> vec.at(pos) -> data_[pos]
-    return at(pos);
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::const_reference
+containers::vector<T, Allocator, GrowthPolicy>::operator[](size_type pos) const noexcept {
+    CONTAINERS_CHECK_INDEX(pos, size_);
+    return data_[pos];
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::reference containers::vector<T, Allocator>::front() const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::reference
+containers::vector<T, Allocator, GrowthPolicy>::front() const {
     return data_[0];
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::reference containers::vector<T, Allocator>::back() const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::reference
+containers::vector<T, Allocator, GrowthPolicy>::back() const {
     return data_[size_ - 1];
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::iterator containers::vector<T, Allocator>::begin() const noexcept {
-    // when forming return value, compiler created new iterator
-    // using default constructor with given argument `T* data_`
+template <typename T, typename Allocator, typename GrowthPolicy>
+T *containers::vector<T, Allocator, GrowthPolicy>::data() noexcept {
     return data_;
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::iterator containers::vector<T, Allocator>::end() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+const T *containers::vector<T, Allocator, GrowthPolicy>::data() const noexcept {
+    return data_;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::iterator
+containers::vector<T, Allocator, GrowthPolicy>::begin() noexcept {
+    return data_;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::const_iterator
+containers::vector<T, Allocator, GrowthPolicy>::begin() const noexcept {
+    return data_;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::const_iterator
+containers::vector<T, Allocator, GrowthPolicy>::cbegin() const noexcept {
+    return data_;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::iterator
+containers::vector<T, Allocator, GrowthPolicy>::end() noexcept {
     return data_ + size_;
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::size_type containers::vector<T, Allocator>::size() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::const_iterator
+containers::vector<T, Allocator, GrowthPolicy>::end() const noexcept {
+    return data_ + size_;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::const_iterator
+containers::vector<T, Allocator, GrowthPolicy>::cend() const noexcept {
+    return data_ + size_;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::size_type
+containers::vector<T, Allocator, GrowthPolicy>::size() const noexcept {
     return size_;
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::size_type containers::vector<T, Allocator>::capacity() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::size_type
+containers::vector<T, Allocator, GrowthPolicy>::capacity() const noexcept {
     return capacity_;
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::size_type containers::vector<T, Allocator>::max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(T);
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::size_type
+containers::vector<T, Allocator, GrowthPolicy>::max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
 }
 
-template <typename T, typename Allocator>
-bool containers::vector<T, Allocator>::empty() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+bool containers::vector<T, Allocator, GrowthPolicy>::empty() const noexcept {
     return size_ == 0;
 }
 
-template <typename T, typename Allocator>
-void containers::vector<T, Allocator>::reserve(size_type size) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void containers::vector<T, Allocator, GrowthPolicy>::reserve(size_type size) {
     if (size > capacity_ && size < max_size()) {
-        T *new_data = allocator_.allocate(size);
-        for (size_type i = 0; i < size_; ++i) {
-            new_data[i] = std::move(data_[i]);
+        if constexpr (detail::can_reallocate_v<Allocator, T>) {
+            data_ = allocator_.reallocate(data_, capacity_, size);
+        } else {
+            T *new_data = allocator_.allocate(size);
+            try {
+                detail::relocate(data_, size_, new_data);
+            } catch (...) {
+                allocator_.deallocate(new_data, size);
+                throw;
+            }
+            if (data_) {
+                allocator_.deallocate(data_, capacity_);
+            }
+            data_ = new_data;
         }
-        if (data_) {
-            allocator_.deallocate(data_, capacity_);
-        }
-        data_ = new_data;
         capacity_ = size;
     }
 }
 
-template <typename T, typename Allocator>
-void containers::vector<T, Allocator>::shrink_to_fit() {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void containers::vector<T, Allocator, GrowthPolicy>::shrink_to_fit() {
     if (size_ < capacity_) {
-        int *new_data = allocator_.allocate(size_);
-        for (size_type i = 0; i < size_; ++i) {
-            new_data[i] = std::move(data_[i]);
+        if constexpr (detail::can_reallocate_v<Allocator, T>) {
+            if (size_) {
+                data_ = allocator_.reallocate(data_, capacity_, size_);
+                capacity_ = size_;
+                return;
+            }
+        }
+        T *new_data = size_ ? allocator_.allocate(size_) : nullptr;
+        try {
+            detail::relocate(data_, size_, new_data);
+        } catch (...) {
+            if (new_data) allocator_.deallocate(new_data, size_);
+            throw;
         }
         if (data_) {
             allocator_.deallocate(data_, capacity_);
@@ -260,160 +351,293 @@ void containers::vector<T, Allocator>::shrink_to_fit() {
     }
 }
 
-template <typename T, typename Allocator>
-void containers::vector<T, Allocator>::clear() {  // capacity_ remains, size_ = zero
-    for (size_type i = 0; i < size_; i++) {
-        data_[i].~T();
-    }
+template <typename T, typename Allocator, typename GrowthPolicy>
+void containers::vector<T, Allocator, GrowthPolicy>::clear() {  // capacity_ remains, size_ = zero
+    detail::destroy(data_, size_);
     size_ = 0;
 }
 
-template <typename T, typename Allocator>
-typename containers::vector<T, Allocator>::iterator containers::vector<T, Allocator>::insert(
-    iterator pos,
-    const_reference value) {  //  vec1.insert(vec1.begin() + 3, 0);
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::iterator
+containers::vector<T, Allocator, GrowthPolicy>::insert(
+    const_iterator pos, const_reference value) {  //  vec1.insert(vec1.begin() + 3, 0);
+    return emplace(pos, value);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::iterator
+containers::vector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename InputIt, typename>
+typename containers::vector<T, Allocator, GrowthPolicy>::iterator
+containers::vector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, InputIt first,
+                                                       InputIt last) {
     if (pos < begin() || pos > end()) {
         throw std::out_of_range("out_of_range");
     }
 
-    size_t index = 0;
-    while (data_ + index != pos.get_ptr()) ++index;
-
-    if (size_ == capacity_) {
-        reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    size_type index = pos - cbegin();
+    if constexpr (detail::is_single_pass_v<InputIt>) {
+        // the length is unknown up front, append and rotate into place
+        size_type old_size = size_;
+        for (; first != last; ++first) emplace_back(*first);
+        std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    } else {
+        // [first, last) must not point into the vector
+        insert_gap(index, detail::distance(first, last),
+                   [&](T *slot) { detail::uninitialized_copy(first, last, slot); });
     }
 
-    print();
+    return begin() + index;
+}
 
-    size_t counter = 0;
-    iterator iter = end();  // end points to the last element because size_ has not increased yet
-    while (counter != (size_ - index)) {
-        *iter = std::move(*(iter - 1));
-        counter++;
-        --iter;
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::iterator
+containers::vector<T, Allocator, GrowthPolicy>::erase(const_iterator pos) {
+    if (pos < begin() || pos >= end()) {
+        throw std::out_of_range("out_of_range");
     }
 
-    *iter = value;
-    ++size_;
+    size_type index = pos - cbegin();
+    detail::erase_shift(data_ + index, size_ - index);
+    --size_;
 
-    return iter;
+    return data_ + index;
 }
 
-template <typename T, typename Allocator>
-void containers::vector<T, Allocator>::push_back(const_reference value) {
-    if (size_ + 1 > capacity_) {
-        reserve(size_ == 0 ? 1 : capacity_ * 2);
-    }
-    data_[size_] = value;
-    ++size_;
+template <typename T, typename Allocator, typename GrowthPolicy>
+void containers::vector<T, Allocator, GrowthPolicy>::push_back(const_reference value) {
+    emplace_back(value);
 }
 
-template <typename T, typename Allocator>
-void containers::vector<T, Allocator>::push_back(reference &value) {  // vec.push_back(3) using move semantics
-    if (size_ == 0) {
-        reserve(size_ + 1);  //
-    } else if (size_ + 1 > capacity_) {
-        reserve(capacity_ * 2);
-    }
-    data_[size_] = std::move(value);  // `value` IS ALREADY R-VALUE
-    ++size_;
+template <typename T, typename Allocator, typename GrowthPolicy>
+void containers::vector<T, Allocator, GrowthPolicy>::push_back(
+    value_type &&value) {  // vec.push_back(3) using move semantics
+    emplace_back(std::move(value));
 }
 
-template <typename T, typename Allocator>
-void containers::vector<T, Allocator>::pop_back() {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void containers::vector<T, Allocator, GrowthPolicy>::pop_back() {
     if (size_ > 0) {
-        data_[size_ - 1] = 0;
+        data_[size_ - 1].~T();
         --size_;
     }
 }
 
-template <typename T, typename Allocator>
-void containers::vector<T, Allocator>::swap(vector &other) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void containers::vector<T, Allocator, GrowthPolicy>::swap(vector &other) {
     std::swap(data_, other.data_);
     std::swap(capacity_, other.capacity_);
     std::swap(size_, other.size_);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename... Args>
-typename containers::vector<T, Allocator>::iterator containers::vector<T, Allocator>::insert_many(iterator pos,
-                                                                                        Args &&...args) {
+typename containers::vector<T, Allocator, GrowthPolicy>::iterator
+containers::vector<T, Allocator, GrowthPolicy>::insert_many(const_iterator pos, Args &&...args) {
     // Check if the insertion position is within valid bounds
     if (pos < begin() || pos > end()) {
         throw std::out_of_range("out_of_range");
     }
 
     // Calculate the index of the insertion position
-    size_t index = 0;
-    while (data_ + index != pos.get_ptr()) ++index;
+    size_type index = pos - cbegin();
+
+    if ((holds(args) || ...)) {
+        // an argument is an element that may be relocated before it is read, build them first
+        vector temp;
+        temp.reserve(sizeof...(Args));
+        (temp.emplace_back(std::forward<Args>(args)), ...);
+        insert_gap(index, sizeof...(Args),
+                   [&](T *first) { detail::relocate_construct(temp.data(), temp.size(), first); });
+        return begin() + index;
+    }
 
-    // Create a temporary vector from the provided arguments
-    vector<T> temp_vector({std::forward<Args>(args)...});
-    size_t temp_size = temp_vector.size();
+    // Construct every argument straight into the gap
+    insert_gap(index, sizeof...(Args), [&](T *first) {
+        T *last = first;
+        try {
+            ((::new (static_cast<void *>(last)) T(std::forward<Args>(args)), ++last), ...);
+        } catch (...) {
+            detail::destroy(first, last - first);
+            throw;
+        }
+    });
 
-    // Ensure there is enough capacity, and reserve more space if necessary
-    if (size_ + temp_size > capacity_) {
-        reserve(capacity_ == 0 ? temp_size : capacity_ * 2);
-    }
+    // Return an iterator to the first of the newly inserted elements
+    return begin() + index;
+}
 
-    // Shift existing elements to the right to make space for new elements
-    size_t counter = 0;
-    iterator iter = end();
-    while (counter < size_ - index) {
-        *(iter + temp_size - 1) = std::move(*(iter - 1));
-        counter++;
-        --iter;
-    }
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+void containers::vector<T, Allocator, GrowthPolicy>::insert_many_back(Args &&...args) {
+    insert_many(end(), std::forward<Args>(args)...);
+}
 
-    // Move new elements into the insertion position
-    for (size_t i = 0; i < temp_size; ++i) {
-        *(begin() + index + i) = std::move(temp_vector[i]);
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+void containers::vector<T, Allocator, GrowthPolicy>::insert_many_front(Args &&...args) {
+    insert_many(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+typename containers::vector<T, Allocator, GrowthPolicy>::iterator
+containers::vector<T, Allocator, GrowthPolicy>::emplace(const_iterator pos, Args &&...args) {
+    if (pos < begin() || pos > end()) {
+        throw std::out_of_range("out_of_range");
     }
 
-    // Update the size of the vector
-    size_ += temp_size;
+    size_type index = pos - cbegin();
+    bool relocates = index != size_ ? size_ < capacity_ || detail::can_reallocate_v<Allocator, T>
+                                    : size_ == capacity_ && detail::can_reallocate_v<Allocator, T>;
+    if (relocates) {
+        // the arguments may refer to elements that are about to be relocated
+        T temp(std::forward<Args>(args)...);
+        insert_gap(index, 1, [&](T *slot) { ::new (static_cast<void *>(slot)) T(std::move(temp)); });
+    } else {
+        insert_gap(index, 1,
+                   [&](T *slot) { ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...); });
+    }
 
-    // Return an iterator to the first of the newly inserted elements
     return begin() + index;
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename... Args>
-void containers::vector<T, Allocator>::insert_many_back(Args &&...args) {
-    // the fold expression operator that calls the push_back function for
-    // each argument in the args argument package
-    (push_back(args), ...);  // push_back(args1), push_back(args2), push_back(args3);
+typename containers::vector<T, Allocator, GrowthPolicy>::reference
+containers::vector<T, Allocator, GrowthPolicy>::emplace_back(Args &&...args) {
+    if (size_ < capacity_) {
+        ::new (static_cast<void *>(data_ + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+    } else if constexpr (detail::can_reallocate_v<Allocator, T>) {
+        // the buffer is resized in place, so the arguments must not point into it any more
+        T temp(std::forward<Args>(args)...);
+        reserve(recommended_capacity(size_ + 1));
+        ::new (static_cast<void *>(data_ + size_)) T(std::move(temp));
+        ++size_;
+    } else {
+        insert_gap(size_, 1,
+                   [&](T *slot) { ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...); });
+    }
+    return data_[size_ - 1];
 }
 
-template <typename T, typename Allocator>
-template <typename... Args>
-void containers::vector<T, Allocator>::insert_many_front(Args &&...args) {
-    // Create a temporary vector from the provided arguments
-    vector<T> temp_vector({args...});
-    size_type temp_size = temp_vector.size();
-    size_type new_size = temp_size + size_;
-
-    // Ensure there is enough capacity, and reserve more space if necessary
-    if (new_size > capacity_) {
-        reserve(new_size > capacity_ * 2 ? new_size : capacity_ * 2);
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename InputIt, typename>
+void containers::vector<T, Allocator, GrowthPolicy>::assign(InputIt first, InputIt last) {
+    clear();
+    if constexpr (detail::is_single_pass_v<InputIt>) {
+        for (; first != last; ++first) emplace_back(*first);
+    } else {
+        size_type count = detail::distance(first, last);
+        if (count > capacity_) {
+            if (data_) {
+                allocator_.deallocate(data_, capacity_);
+                data_ = nullptr;
+                capacity_ = 0;
+            }
+            data_ = allocator_.allocate(count);
+            capacity_ = count;
+        }
+        detail::uninitialized_copy(first, last, data_);
+        size_ = count;
     }
+}
 
-    // Shift existing elements to the right to make space at the front
-    for (iterator iter = end() + temp_size - 1; iter != begin() + temp_size - 1; --iter) {
-        *(iter) = std::move(*(iter - temp_size));
-    }
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename Range>
+void containers::vector<T, Allocator, GrowthPolicy>::append_range(const Range &range) {
+    insert(end(), std::begin(range), std::end(range));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename containers::vector<T, Allocator, GrowthPolicy>::size_type
+containers::vector<T, Allocator, GrowthPolicy>::recommended_capacity(
+    size_type required) const noexcept {
+    return GrowthPolicy::next_capacity(capacity_, required, sizeof(T));
+}
 
-    // Move new elements into the front of the vector
-    for (size_type i = 0; i < temp_size; ++i) {
-        *(begin() + i) = std::move(temp_vector[i]);
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename Construct>
+void containers::vector<T, Allocator, GrowthPolicy>::insert_gap(
+    size_type index, size_type count, Construct construct) {
+    // opens `count` uninitialized slots at `index` and fills them with `construct(first_slot)`
+    if constexpr (detail::can_reallocate_v<Allocator, T>) {
+        // the allocator resizes the block itself, callers keep the arguments out of the old buffer
+        if (size_ + count > capacity_) reserve(recommended_capacity(size_ + count));
     }
+    if (size_ + count > capacity_) {
+        // construct before relocating, the arguments may live in the old buffer
+        size_type new_capacity = recommended_capacity(size_ + count);
+        T *new_data = allocator_.allocate(new_capacity);
+        try {
+            construct(new_data + index);
+        } catch (...) {
+            allocator_.deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            detail::relocate(data_, index, new_data, data_ + index, size_ - index,
+                             new_data + index + count);
+        } catch (...) {
+            detail::destroy(new_data + index, count);
+            allocator_.deallocate(new_data, new_capacity);
+            throw;
+        }
+        if (data_) {
+            allocator_.deallocate(data_, capacity_);
+        }
+        data_ = new_data;
+        capacity_ = new_capacity;
+    } else if (detail::is_nothrow_relocatable_v<T> || index == size_) {
+        detail::relocate_overlapping(data_ + index, size_ - index, data_ + index + count);
+        try {
+            construct(data_ + index);
+        } catch (...) {
+            detail::relocate_overlapping(data_ + index + count, size_ - index, data_ + index);
+            throw;
+        }
+    } else if constexpr (!detail::is_nothrow_relocatable_v<T>) {
+        // a failed copy cannot be undone in place, these are shifted by assignment; construct
+        // fills raw memory, so the new elements are built aside first
+        T *values = allocator_.allocate(count);
+        try {
+            construct(values);
+        } catch (...) {
+            allocator_.deallocate(values, count);
+            throw;
+        }
+        try {
+            detail::insert_shift(data_ + index, size_ - index, values, count);
+        } catch (...) {
+            detail::destroy(values, count);
+            allocator_.deallocate(values, count);
+            throw;
+        }
+        detail::destroy(values, count);
+        allocator_.deallocate(values, count);
+    }
+    size_ += count;
+}
 
-    // Update the size of the vector
-    size_ = new_size;
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename U>
+bool containers::vector<T, Allocator, GrowthPolicy>::holds(const U &arg) const noexcept {
+    if constexpr (std::is_same_v<U, T>) {
+        std::less<const T *> less;
+        return !less(&arg, data_) && less(&arg, data_ + size_);
+    } else {
+        (void)arg;
+        return false;
+    }
 }
 
-template <typename T, typename Allocator>
-void containers::vector<T, Allocator>::print() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void containers::vector<T, Allocator, GrowthPolicy>::print() const noexcept {
     for (auto &item : *this) std::cout << item << " ";
 }
 
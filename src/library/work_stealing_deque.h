@@ -0,0 +1,166 @@
+#ifndef CONTAINERS_WORK_STEALING_DEQUE
+#define CONTAINERS_WORK_STEALING_DEQUE
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "cache_line.h"
+#include "vector.h"
+
+namespace containers {
+// Chase-Lev work-stealing deque: one owner thread pushes and pops at the bottom, any number of
+// thief threads steal from the top. The owner only synchronizes with thieves when the deque holds
+// one element, so a thread working on its own tasks pays one uncontended store per push and pop.
+// The ring doubles when it is full; rings the thieves may still be reading are kept until the
+// deque is destroyed. Follows the C11 formulation of Le, Pop, Cohen and Zappa Nardelli (2013),
+// with sequentially consistent accesses in place of the fences.
+//
+// Elements are copied in and out of atomic slots, so T must be trivially copyable (typically a
+// pointer to a task).
+template <typename T>
+class work_stealing_deque {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "work_stealing_deque elements must be trivially copyable");
+
+    using value_type = T;
+    using reference = T &;
+    using size_type = size_t;
+
+   private:
+    struct ring {
+        std::ptrdiff_t mask_;
+        std::unique_ptr<std::atomic<T>[]> slots_;
+
+        explicit ring(std::ptrdiff_t capacity)
+            : mask_(capacity - 1), slots_(new std::atomic<T>[capacity]) {}
+        T get(std::ptrdiff_t pos) const noexcept {
+            return slots_[pos & mask_].load(std::memory_order_relaxed);
+        }
+        void put(std::ptrdiff_t pos, T value) noexcept {
+            slots_[pos & mask_].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    // read by thieves, written by the thief or owner that takes the oldest element
+    alignas(cache_line_size) std::atomic<std::ptrdiff_t> top_{0};
+    // written by the owner
+    alignas(cache_line_size) std::atomic<std::ptrdiff_t> bottom_{0};
+    std::atomic<ring *> ring_;
+    vector<std::unique_ptr<ring>> rings_;
+
+    // moves the elements in [top, bottom) to a ring twice as large, called by the owner
+    ring *grow(ring *old, std::ptrdiff_t top, std::ptrdiff_t bottom);
+
+   public:
+    // Work stealing deque Member functions
+    explicit work_stealing_deque(size_type capacity = 64);
+    work_stealing_deque(const work_stealing_deque &) = delete;
+    work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+    ~work_stealing_deque() = default;
+
+    // Work stealing deque Capacity
+    // Snapshots, exact only while no other thread uses the deque.
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+
+    // Work stealing deque Owner
+    void push(value_type value);
+    // Takes the newest element, false when the deque is empty.
+    bool pop(reference value) noexcept;
+
+    // Work stealing deque Thieves
+    // Takes the oldest element, false when the deque is empty or another thread took it first.
+    bool steal(reference value) noexcept;
+};
+}  // namespace containers
+
+template <typename T>
+containers::work_stealing_deque<T>::work_stealing_deque(size_type capacity) {
+    if (capacity == 0 || capacity > size_type(1) << (sizeof(size_type) * 8 - 3)) {
+        throw std::length_error("length_error");
+    }
+    std::ptrdiff_t rounded = 1;
+    while (static_cast<size_type>(rounded) < capacity) rounded *= 2;
+    rings_.push_back(std::make_unique<ring>(rounded));
+    ring_.store(rings_.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+bool containers::work_stealing_deque<T>::empty() const noexcept {
+    return size() == 0;
+}
+
+template <typename T>
+size_t containers::work_stealing_deque<T>::size() const noexcept {
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+template <typename T>
+size_t containers::work_stealing_deque<T>::capacity() const noexcept {
+    return ring_.load(std::memory_order_relaxed)->mask_ + 1;
+}
+
+template <typename T>
+typename containers::work_stealing_deque<T>::ring *containers::work_stealing_deque<T>::grow(
+    ring *old, std::ptrdiff_t top, std::ptrdiff_t bottom) {
+    rings_.push_back(std::make_unique<ring>((old->mask_ + 1) * 2));
+    ring *bigger = rings_.back().get();
+    for (std::ptrdiff_t pos = top; pos < bottom; ++pos) bigger->put(pos, old->get(pos));
+    ring_.store(bigger, std::memory_order_release);
+    return bigger;
+}
+
+template <typename T>
+void containers::work_stealing_deque<T>::push(value_type value) {
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+    ring *current = ring_.load(std::memory_order_relaxed);
+    if (bottom - top > current->mask_) current = grow(current, top, bottom);
+    current->put(bottom, value);
+    bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool containers::work_stealing_deque<T>::pop(reference value) noexcept {
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    ring *current = ring_.load(std::memory_order_relaxed);
+    // reserve the bottom element before looking at top, thieves see the reservation
+    bottom_.store(bottom, std::memory_order_seq_cst);
+    std::ptrdiff_t top = top_.load(std::memory_order_seq_cst);
+    if (top > bottom) {
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    value = current->get(bottom);
+    if (top == bottom) {
+        // the last element, race the thieves for it
+        bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+template <typename T>
+bool containers::work_stealing_deque<T>::steal(reference value) noexcept {
+    std::ptrdiff_t top = top_.load(std::memory_order_seq_cst);
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_seq_cst);
+    if (top >= bottom) return false;
+    ring *current = ring_.load(std::memory_order_acquire);
+    T item = current->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+        return false;
+    }
+    value = item;
+    return true;
+}
+
+#endif
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../library/algorithm.h"
+#include "../library/array.h"
+#include "../library/vector.h"
+
+namespace {
+using containers::detail::simd_level;
+
+// Every instruction set the running CPU supports, so each kernel is compared to the scalar loops.
+std::vector<simd_level> SupportedLevels() {
+    std::vector<simd_level> levels{simd_level::scalar};
+    for (simd_level level : {simd_level::sse2, simd_level::avx2, simd_level::avx512}) {
+        if (level <= containers::detail::cpu_simd_level()) levels.push_back(level);
+    }
+    return levels;
+}
+
+// Sizes around the vector widths, small values so that matches are frequent.
+template <typename T>
+std::vector<std::vector<T>> Samples() {
+    std::mt19937 gen(21);
+    std::uniform_int_distribution<int> value(-5, 5);
+    std::vector<std::vector<T>> samples;
+    for (size_t size : {0, 1, 3, 4, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 257, 1000}) {
+        std::vector<T> sample(size);
+        for (auto &item : sample) item = static_cast<T>(value(gen));
+        samples.push_back(sample);
+    }
+    return samples;
+}
+
+template <typename T>
+void CheckKernels() {
+    namespace detail = containers::detail;
+    for (simd_level level : SupportedLevels()) {
+        for (const std::vector<T> &sample : Samples<T>()) {
+            const T *data = sample.data();
+            size_t n = sample.size();
+            for (int probe = -6; probe <= 6; ++probe) {
+                T value = static_cast<T>(probe);
+                EXPECT_EQ(detail::find(level, data, n, value),
+                          detail::scalar::find(data, n, value));
+                EXPECT_EQ(detail::count(level, data, n, value),
+                          detail::scalar::count(data, n, value));
+            }
+            EXPECT_EQ(detail::extreme_index<false>(level, data, n),
+                      detail::scalar::extreme_index<false>(data, n));
+            EXPECT_EQ(detail::extreme_index<true>(level, data, n),
+                      detail::scalar::extreme_index<true>(data, n));
+
+            std::vector<T> copy = sample;
+            EXPECT_TRUE(detail::equal(level, data, copy.data(), n));
+            for (size_t i = 0; i < n; i += 7) {
+                copy[i] = static_cast<T>(copy[i] + 1);
+                EXPECT_FALSE(detail::equal(level, data, copy.data(), n));
+                copy[i] = sample[i];
+            }
+
+            std::vector<T> filled(n + 1, T(9));
+            detail::fill(level, filled.data(), n, T(3));
+            EXPECT_EQ(std::count(filled.begin(), filled.end() - 1, T(3)), static_cast<long>(n));
+            EXPECT_EQ(filled.back(), T(9));
+        }
+    }
+}
+}  // namespace
+
+TEST(AlgorithmTests, Int8Kernels) { CheckKernels<int8_t>(); }
+
+TEST(AlgorithmTests, Uint8Kernels) { CheckKernels<uint8_t>(); }
+
+TEST(AlgorithmTests, CharKernels) { CheckKernels<char>(); }
+
+TEST(AlgorithmTests, Int32Kernels) { CheckKernels<int32_t>(); }
+
+TEST(AlgorithmTests, Uint32Kernels) { CheckKernels<uint32_t>(); }
+
+TEST(AlgorithmTests, FloatKernels) { CheckKernels<float>(); }
+
+TEST(AlgorithmTests, DoubleUsesScalar) { CheckKernels<double>(); }
+
+TEST(AlgorithmTests, ExtremesAtBoundaries) {
+    namespace detail = containers::detail;
+    for (simd_level level : SupportedLevels()) {
+        std::vector<uint32_t> values(100, 7);
+        values[99] = 0xFFFFFFFFu;  // above INT32_MAX, so the unsigned order matters
+        values[42] = 0;
+        EXPECT_EQ(detail::extreme_index<true>(level, values.data(), values.size()), 99U);
+        EXPECT_EQ(detail::extreme_index<false>(level, values.data(), values.size()), 42U);
+
+        std::vector<int8_t> bytes(70, 0);
+        bytes[69] = -128;
+        bytes[0] = 127;
+        EXPECT_EQ(detail::extreme_index<false>(level, bytes.data(), bytes.size()), 69U);
+        EXPECT_EQ(detail::extreme_index<true>(level, bytes.data(), bytes.size()), 0U);
+    }
+}
+
+TEST(AlgorithmTests, VectorAlgorithms) {
+    containers::vector<int> s21_vec{5, 3, 8, 3, 1, 9, 1};
+    std::vector<int> std_vec{5, 3, 8, 3, 1, 9, 1};
+    EXPECT_EQ(*containers::find(s21_vec, 3), *std::find(std_vec.begin(), std_vec.end(), 3));
+    EXPECT_EQ(containers::find(s21_vec, 4), s21_vec.end());
+    EXPECT_EQ(containers::count(s21_vec, 1),
+              static_cast<size_t>(std::count(std_vec.begin(), std_vec.end(), 1)));
+    EXPECT_EQ(containers::min_element(s21_vec), s21_vec.begin() + 4);
+    EXPECT_EQ(containers::max_element(s21_vec), s21_vec.begin() + 5);
+
+    containers::vector<int> s21_copy(s21_vec);
+    EXPECT_TRUE(containers::equal(s21_vec, s21_copy));
+    s21_copy.push_back(0);
+    EXPECT_FALSE(containers::equal(s21_vec, s21_copy));
+
+    containers::fill(s21_vec, 2);
+    EXPECT_EQ(containers::count(s21_vec, 2), s21_vec.size());
+
+    containers::vector<int> s21_empty;
+    EXPECT_EQ(containers::min_element(s21_empty), s21_empty.end());
+}
+
+TEST(AlgorithmTests, NonArithmeticElements) {
+    containers::vector<std::string> s21_vec{"b", "a", "c", "a"};
+    EXPECT_EQ(containers::find(s21_vec, std::string("a")), s21_vec.begin() + 1);
+    EXPECT_EQ(containers::count(s21_vec, std::string("a")), 2U);
+    EXPECT_EQ(*containers::max_element(s21_vec), "c");
+}
+
+TEST(AlgorithmTests, ArrayFill) {
+    containers::array<float, 37> s21_arr;
+    std::array<float, 37> std_arr;
+    s21_arr.fill(1.5f);
+    std_arr.fill(1.5f);
+    for (size_t i = 0; i < std_arr.size(); ++i) EXPECT_EQ(s21_arr[i], std_arr[i]);
+    EXPECT_EQ(containers::count(s21_arr, 1.5f), 37U);
+    EXPECT_TRUE(containers::equal(s21_arr, s21_arr));
+}
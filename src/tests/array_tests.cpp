@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <iostream>
+#include <numeric>
 
 #include "../library/array.h"
 
@@ -77,6 +79,40 @@ TEST(ArrayTests, OperatorSquareBrackets) {
     EXPECT_EQ(s21_arr[4], std_arr[4]);
 }
 
+TEST(ArrayTests, CheckedOperatorSquareBrackets) {
+    containers::array<int, 3> s21_arr{1, 2, 3};
+    const containers::array<int, 3> &s21_const = s21_arr;
+    EXPECT_DEATH(s21_arr[3], "out of range");
+    EXPECT_EQ(s21_const[2], 3);
+    EXPECT_THROW(s21_const.at(3), std::out_of_range);
+}
+
+TEST(ArrayTests, DataMethod) {
+    containers::array<int, 3> s21_arr{1, 2, 3};
+    std::array<int, 3> std_arr{1, 2, 3};
+    s21_arr.data()[0] = 10;
+    std_arr.data()[0] = 10;
+    for (size_t i = 0; i < std_arr.size(); ++i) EXPECT_EQ(s21_arr.data()[i], std_arr.data()[i]);
+}
+
+TEST(ArrayTests, Iterators) {
+    containers::array<int, 5> s21_arr{4, 2, 5, 1, 3};
+    std::array<int, 5> std_arr{4, 2, 5, 1, 3};
+    EXPECT_EQ(s21_arr.end() - s21_arr.begin(), std_arr.end() - std_arr.begin());
+    EXPECT_EQ(s21_arr.begin()[2], std_arr.begin()[2]);
+    std::sort(s21_arr.begin(), s21_arr.end());
+    std::sort(std_arr.begin(), std_arr.end());
+    EXPECT_TRUE(std::equal(s21_arr.begin(), s21_arr.end(), std_arr.begin(), std_arr.end()));
+
+    const containers::array<int, 5> &s21_const = s21_arr;
+    containers::array<int, 5>::const_iterator it = s21_const.begin();
+    it += 3;
+    EXPECT_EQ(*it, std_arr[3]);
+    EXPECT_EQ(it, s21_arr.cbegin() + 3);
+    EXPECT_EQ(std::accumulate(s21_arr.cbegin(), s21_arr.cend(), 0),
+              std::accumulate(std_arr.cbegin(), std_arr.cend(), 0));
+}
+
 TEST(ArrayTests, SizeMethod) {
     containers::array<int, 5> s21_arr{1, 2, 3, 4, 5};
     std::array<int, 5> std_arr{1, 2, 3, 4, 5};
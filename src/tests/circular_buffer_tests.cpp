@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../library/circular_buffer.h"
+#include "../library/list.h"
+#include "../library/queue.h"
+
+TEST(CircularBufferTests, DefaultConstructor) {
+    containers::circular_buffer<int> s21_buf;
+    EXPECT_TRUE(s21_buf.empty());
+    EXPECT_EQ(s21_buf.size(), 0U);
+    EXPECT_EQ(s21_buf.capacity(), 0U);
+    EXPECT_TRUE(s21_buf.begin() == s21_buf.end());
+}
+
+TEST(CircularBufferTests, CapacityIsPowerOfTwo) {
+    containers::circular_buffer<int> s21_buf(100);
+    EXPECT_EQ(s21_buf.capacity(), 128U);
+    s21_buf.reserve(129);
+    EXPECT_EQ(s21_buf.capacity(), 256U);
+    s21_buf.reserve(10);
+    EXPECT_EQ(s21_buf.capacity(), 256U);
+}
+
+TEST(CircularBufferTests, InitializerListAndAccess) {
+    containers::circular_buffer<int> s21_buf = {1, 2, 3, 4, 5};
+    EXPECT_EQ(s21_buf.size(), 5U);
+    EXPECT_EQ(s21_buf.front(), 1);
+    EXPECT_EQ(s21_buf.back(), 5);
+    EXPECT_EQ(s21_buf[2], 3);
+    EXPECT_EQ(s21_buf.at(4), 5);
+    EXPECT_THROW(s21_buf.at(5), std::out_of_range);
+    s21_buf.front() = 10;
+    EXPECT_EQ(*s21_buf.begin(), 10);
+}
+
+TEST(CircularBufferTests, MatchesStdDequeAcrossWrapAndGrowth) {
+    containers::circular_buffer<std::string> s21_buf;
+    std::deque<std::string> std_deq;
+    std::mt19937 random(3);
+    for (int i = 0; i < 5000; ++i) {
+        std::string value = std::to_string(i);
+        switch (random() % 6) {
+            case 0:
+            case 1:
+                s21_buf.push_back(value);
+                std_deq.push_back(value);
+                break;
+            case 2:
+                s21_buf.emplace_front(value);
+                std_deq.emplace_front(value);
+                break;
+            case 3:
+                s21_buf.pop_front();
+                if (!std_deq.empty()) std_deq.pop_front();
+                break;
+            case 4:
+                s21_buf.pop_back();
+                if (!std_deq.empty()) std_deq.pop_back();
+                break;
+            default:
+                s21_buf.push_back(std::move(value));
+                std_deq.push_back(std::to_string(i));
+        }
+        ASSERT_EQ(s21_buf.size(), std_deq.size());
+    }
+    EXPECT_TRUE(std::equal(s21_buf.begin(), s21_buf.end(), std_deq.begin(), std_deq.end()));
+    if (!std_deq.empty()) {
+        EXPECT_EQ(s21_buf.front(), std_deq.front());
+        EXPECT_EQ(s21_buf.back(), std_deq.back());
+    }
+}
+
+TEST(CircularBufferTests, FixedCapacity) {
+    containers::circular_buffer<int> s21_buf(3, containers::fixed_capacity);
+    EXPECT_EQ(s21_buf.capacity(), 3U);
+    for (int i = 0; i < 3; ++i) s21_buf.push_back(i);
+    EXPECT_TRUE(s21_buf.full());
+    EXPECT_THROW(s21_buf.push_back(3), std::length_error);
+    EXPECT_THROW(s21_buf.push_front(3), std::length_error);
+    EXPECT_THROW(s21_buf.reserve(4), std::length_error);
+    EXPECT_EQ(s21_buf.size(), 3U);
+
+    // the ring keeps working past the end of the buffer
+    for (int i = 3; i < 20; ++i) {
+        s21_buf.pop_front();
+        s21_buf.push_back(i);
+    }
+    EXPECT_EQ(s21_buf.capacity(), 3U);
+    EXPECT_EQ(s21_buf.front(), 17);
+    EXPECT_EQ(s21_buf.back(), 19);
+
+    containers::circular_buffer<int> s21_copy(s21_buf);
+    EXPECT_THROW(s21_copy.push_back(20), std::length_error);
+    EXPECT_THROW((containers::circular_buffer<int>(0, containers::fixed_capacity)),
+                 std::length_error);
+}
+
+TEST(CircularBufferTests, FixedCapacityIsNotRounded) {
+    containers::circular_buffer<int> s21_buf(5, containers::fixed_capacity);
+    for (int i = 0; i < 5; ++i) s21_buf.push_front(i);
+    EXPECT_TRUE(s21_buf.full());
+    EXPECT_THROW(s21_buf.push_back(5), std::length_error);
+    EXPECT_EQ(s21_buf.size(), 5U);
+    EXPECT_EQ(s21_buf.capacity(), 5U);
+    containers::circular_buffer<int> s21_moved(std::move(s21_buf));
+    EXPECT_THROW(s21_moved.push_front(5), std::length_error);
+    s21_moved.pop_back();
+    s21_moved.push_back(7);
+    EXPECT_EQ(s21_moved.back(), 7);
+}
+
+TEST(CircularBufferTests, IteratorsAreRandomAccess) {
+    containers::circular_buffer<int> s21_buf(8);
+    for (int i = 0; i < 6; ++i) s21_buf.push_back(i);
+    for (int i = 0; i < 4; ++i) s21_buf.pop_front();
+    for (int i = 6; i < 12; ++i) s21_buf.push_back(i);
+    // the elements now wrap around the end of the buffer
+    EXPECT_EQ(s21_buf.capacity(), 8U);
+    EXPECT_EQ(s21_buf.end() - s21_buf.begin(), 8);
+    EXPECT_EQ(s21_buf.begin()[7], 11);
+    EXPECT_EQ(*(s21_buf.end() - 1), 11);
+    EXPECT_TRUE(s21_buf.cbegin() < s21_buf.end());
+    std::sort(s21_buf.begin(), s21_buf.end(), std::greater<>());
+    EXPECT_EQ(s21_buf.front(), 11);
+    EXPECT_EQ(s21_buf.back(), 4);
+    containers::circular_buffer<int>::const_iterator it = s21_buf.begin() + 2;
+    EXPECT_EQ(*it, 9);
+}
+
+TEST(CircularBufferTests, CopyMoveAndSwap) {
+    containers::circular_buffer<std::string> s21_buf1 = {"a", "b", "c"};
+    s21_buf1.push_front("z");
+    containers::circular_buffer<std::string> s21_buf2(s21_buf1);
+    EXPECT_TRUE(std::equal(s21_buf1.begin(), s21_buf1.end(), s21_buf2.begin(), s21_buf2.end()));
+
+    containers::circular_buffer<std::string> s21_buf3(std::move(s21_buf1));
+    EXPECT_TRUE(s21_buf1.empty());
+    EXPECT_EQ(s21_buf3.front(), "z");
+
+    s21_buf1 = s21_buf3;
+    EXPECT_EQ(s21_buf1.size(), 4U);
+    s21_buf2 = {"x"};
+    s21_buf1.swap(s21_buf2);
+    EXPECT_EQ(s21_buf1.size(), 1U);
+    EXPECT_EQ(s21_buf2.back(), "c");
+    s21_buf2 = std::move(s21_buf1);
+    EXPECT_EQ(s21_buf2.front(), "x");
+}
+
+TEST(CircularBufferTests, PushOwnElementWhileGrowing) {
+    containers::circular_buffer<std::string> s21_buf(2);
+    s21_buf.push_back("first");
+    s21_buf.push_back("second");
+    s21_buf.push_back(s21_buf.front());
+    s21_buf.push_front(s21_buf.back());
+    containers::circular_buffer<std::string> expected = {"first", "first", "second", "first"};
+    EXPECT_TRUE(std::equal(s21_buf.begin(), s21_buf.end(), expected.begin(), expected.end()));
+}
+
+TEST(CircularBufferTests, MoveOnlyElements) {
+    containers::circular_buffer<std::unique_ptr<int>> s21_buf;
+    for (int i = 0; i < 20; ++i) s21_buf.emplace_back(new int(i));
+    EXPECT_EQ(*s21_buf.front(), 0);
+    s21_buf.pop_front();
+    EXPECT_EQ(*s21_buf.front(), 1);
+    EXPECT_EQ(*s21_buf.back(), 19);
+}
+
+TEST(CircularBufferTests, QueueBackend) {
+    containers::queue<int> s21_q;
+    containers::queue<int, containers::list<int>> s21_list_q;
+    for (int i = 0; i < 100; ++i) {
+        s21_q.push(i);
+        s21_list_q.push(i);
+        if (i % 3 == 0) {
+            s21_q.pop();
+            s21_list_q.pop();
+        }
+    }
+    EXPECT_EQ(s21_q.size(), s21_list_q.size());
+    while (!s21_q.empty()) {
+        EXPECT_EQ(s21_q.front(), s21_list_q.front());
+        EXPECT_EQ(s21_q.back(), s21_list_q.back());
+        s21_q.pop();
+        s21_list_q.pop();
+    }
+}
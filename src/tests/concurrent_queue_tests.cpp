@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../library/concurrent_queue.h"
+#include "../library/list.h"
+
+TEST(ConcurrentQueueTests, PushAndTryPop) {
+    containers::concurrent_queue<std::string> s21_q;
+    EXPECT_TRUE(s21_q.empty());
+    EXPECT_TRUE(s21_q.push("a"));
+    std::string b = "b";
+    EXPECT_TRUE(s21_q.push(b));
+    EXPECT_TRUE(s21_q.emplace(2, 'c'));
+    EXPECT_EQ(s21_q.size(), 3U);
+
+    std::string value;
+    for (const char *expected : {"a", "b", "cc"}) {
+        EXPECT_TRUE(s21_q.try_pop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(s21_q.try_pop(value));
+}
+
+TEST(ConcurrentQueueTests, PopAllDrainsInOrder) {
+    containers::concurrent_queue<int, containers::list<int>> s21_q;
+    for (int i = 0; i < 10; ++i) s21_q.push(i);
+    std::vector<int> drained;
+    EXPECT_EQ(s21_q.pop_all(std::back_inserter(drained), 4), 4U);
+    EXPECT_EQ(s21_q.try_pop_all(std::back_inserter(drained)), 6U);
+    EXPECT_EQ(s21_q.try_pop_all(std::back_inserter(drained)), 0U);
+    EXPECT_EQ(drained, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(ConcurrentQueueTests, PopForTimesOut) {
+    containers::concurrent_queue<int> s21_q;
+    int value = 0;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(s21_q.pop_for(value, std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+
+    std::thread producer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        s21_q.push(7);
+    });
+    EXPECT_TRUE(s21_q.pop_for(value, std::chrono::seconds(10)));
+    EXPECT_EQ(value, 7);
+    producer.join();
+}
+
+TEST(ConcurrentQueueTests, CloseWakesConsumersAndKeepsRemainingElements) {
+    containers::concurrent_queue<std::unique_ptr<int>> s21_q;
+    std::unique_ptr<int> value;
+    std::thread waiter([&] { EXPECT_FALSE(s21_q.pop_wait(value)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    s21_q.close();
+    waiter.join();
+
+    containers::concurrent_queue<std::unique_ptr<int>> s21_q2;
+    s21_q2.push(std::make_unique<int>(1));
+    s21_q2.close();
+    EXPECT_TRUE(s21_q2.closed());
+    auto refused = std::make_unique<int>(2);
+    EXPECT_FALSE(s21_q2.push(std::move(refused)));
+    EXPECT_NE(refused, nullptr);
+    EXPECT_TRUE(s21_q2.pop_wait(value));
+    EXPECT_EQ(*value, 1);
+    EXPECT_FALSE(s21_q2.pop_wait(value));
+    EXPECT_FALSE(s21_q2.pop_for(value, std::chrono::hours(1)));
+    std::vector<std::unique_ptr<int>> drained;
+    EXPECT_EQ(s21_q2.pop_all(std::back_inserter(drained)), 0U);
+}
+
+TEST(ConcurrentQueueTests, ProducersAndConsumersThreads) {
+    constexpr long kProducers = 3;
+    constexpr long kConsumers = 3;
+    constexpr long kPerProducer = 10000;
+    containers::concurrent_queue<long> s21_q;
+    std::vector<std::thread> producers;
+    for (long p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&s21_q, p] {
+            for (long i = 0; i < kPerProducer; ++i) s21_q.push(p * kPerProducer + i);
+        });
+    }
+    std::vector<long> sums(kConsumers, 0);
+    std::vector<std::thread> consumers;
+    for (long c = 0; c < kConsumers; ++c) {
+        consumers.emplace_back([&, c] {
+            std::vector<long> batch;
+            if (c == 0) {
+                long value;
+                while (s21_q.pop_wait(value)) sums[c] += value;
+                return;
+            }
+            while (s21_q.pop_all(std::back_inserter(batch), 64) != 0) {
+                for (long value : batch) sums[c] += value;
+                batch.clear();
+            }
+        });
+    }
+    for (auto &thread : producers) thread.join();
+    s21_q.close();
+    for (auto &thread : consumers) thread.join();
+
+    long total = kProducers * kPerProducer;
+    long sum = 0;
+    for (long value : sums) sum += value;
+    EXPECT_EQ(sum, total * (total - 1) / 2);
+    EXPECT_TRUE(s21_q.empty());
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stack>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../library/concurrent_stack.h"
+
+TEST(ConcurrentStackTests, IsLifo) {
+    containers::concurrent_stack<int> s21_stack;
+    std::stack<int> std_stack;
+    EXPECT_TRUE(s21_stack.empty());
+    for (int i = 0; i < 1000; ++i) {
+        s21_stack.push(i);
+        std_stack.push(i);
+        if (i % 3 == 0) {
+            int value;
+            ASSERT_TRUE(s21_stack.try_pop(value));
+            ASSERT_EQ(value, std_stack.top());
+            std_stack.pop();
+        }
+    }
+    int value;
+    while (!std_stack.empty()) {
+        ASSERT_TRUE(s21_stack.try_pop(value));
+        ASSERT_EQ(value, std_stack.top());
+        std_stack.pop();
+    }
+    EXPECT_TRUE(s21_stack.empty());
+    EXPECT_FALSE(s21_stack.try_pop(value));
+}
+
+TEST(ConcurrentStackTests, OwnsItsElements) {
+    // the elements left on the stack are destroyed with it
+    containers::concurrent_stack<std::string> s21_stack;
+    std::string text = "a string too long for the small string buffer";
+    s21_stack.push(text);
+    s21_stack.emplace(3, 'x');
+    s21_stack.push(std::move(text));
+    std::string value;
+    EXPECT_TRUE(s21_stack.try_pop(value));
+    EXPECT_EQ(value, "a string too long for the small string buffer");
+    EXPECT_TRUE(s21_stack.try_pop(value));
+    EXPECT_EQ(value, "xxx");
+
+    containers::concurrent_stack<std::unique_ptr<int>, 4> s21_owners;
+    for (int i = 0; i < 300; ++i) s21_owners.emplace(new int(i));
+    std::unique_ptr<int> owner;
+    EXPECT_TRUE(s21_owners.try_pop(owner));
+    EXPECT_EQ(*owner, 299);
+}
+
+TEST(ConcurrentStackTests, ThrowingConstructorKeepsTheStack) {
+    struct Fragile {
+        explicit Fragile(int v) : value(v) {
+            if (v < 0) throw std::invalid_argument("invalid_argument");
+        }
+        int value;
+    };
+    containers::concurrent_stack<Fragile> s21_stack;
+    s21_stack.emplace(1);
+    EXPECT_THROW(s21_stack.emplace(-1), std::invalid_argument);
+    s21_stack.emplace(2);
+    Fragile value(0);
+    EXPECT_TRUE(s21_stack.try_pop(value));
+    EXPECT_EQ(value.value, 2);
+    EXPECT_TRUE(s21_stack.try_pop(value));
+    EXPECT_EQ(value.value, 1);
+    EXPECT_FALSE(s21_stack.try_pop(value));
+}
+
+namespace {
+// Every thread pushes its own values and pops whatever it finds, the values popped by all threads
+// together must be exactly the values pushed.
+template <typename Stack>
+void CheckEveryValueOnce() {
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 5000;
+    Stack s21_stack;
+    std::vector<std::vector<int>> popped(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            int value;
+            for (int i = 0; i < kPerThread; ++i) {
+                s21_stack.push(t * kPerThread + i);
+                if (i % 2 == 1 && s21_stack.try_pop(value)) popped[t].push_back(value);
+                if (i % 64 == 0) std::this_thread::yield();
+            }
+            while (s21_stack.try_pop(value)) popped[t].push_back(value);
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    std::vector<int> seen(kThreads * kPerThread, 0);
+    for (auto &values : popped) {
+        for (int value : values) ++seen[value];
+    }
+    for (int count : seen) ASSERT_EQ(count, 1);
+    EXPECT_TRUE(s21_stack.empty());
+}
+}  // namespace
+
+TEST(ConcurrentStackTests, ThreadsTakeEveryValueOnce) {
+    CheckEveryValueOnce<containers::concurrent_stack<int>>();
+}
+
+TEST(ConcurrentStackTests, EliminationTakesEveryValueOnce) {
+    CheckEveryValueOnce<containers::concurrent_stack<int, 2>>();
+}
+
+TEST(ConcurrentStackTests, BufferPool) {
+    // the free-buffer pool case: threads take a buffer, use it and give it back
+    constexpr int kBuffers = 8;
+    containers::concurrent_stack<std::vector<char> *, 4> s21_pool;
+    std::vector<std::vector<char>> buffers(kBuffers, std::vector<char>(64));
+    for (auto &buffer : buffers) s21_pool.push(&buffer);
+    std::vector<std::atomic<int>> users(kBuffers);
+    std::atomic<bool> shared{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            std::vector<char> *buffer;
+            for (int i = 0; i < 5000; ++i) {
+                if (!s21_pool.try_pop(buffer)) continue;
+                std::atomic<int> &user = users[buffer - buffers.data()];
+                if (user.fetch_add(1) != 0) shared = true;
+                (*buffer)[i % 64] = 1;
+                user.fetch_sub(1);
+                s21_pool.push(buffer);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    EXPECT_FALSE(shared.load());
+    int count = 0;
+    std::vector<char> *buffer;
+    while (s21_pool.try_pop(buffer)) ++count;
+    EXPECT_EQ(count, kBuffers);
+}
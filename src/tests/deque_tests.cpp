@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../library/deque.h"
+#include "../library/queue.h"
+#include "../library/stack.h"
+
+TEST(DequeTests, DefaultConstructor) {
+    containers::deque<int> s21_deq;
+    std::deque<int> std_deq;
+    EXPECT_TRUE(s21_deq.empty());
+    EXPECT_EQ(s21_deq.size(), std_deq.size());
+    EXPECT_TRUE(s21_deq.begin() == s21_deq.end());
+}
+
+TEST(DequeTests, InitializerListAndAccess) {
+    containers::deque<int> s21_deq = {1, 2, 3, 4, 5};
+    EXPECT_EQ(s21_deq.size(), 5U);
+    EXPECT_EQ(s21_deq.front(), 1);
+    EXPECT_EQ(s21_deq.back(), 5);
+    EXPECT_EQ(s21_deq[2], 3);
+    EXPECT_EQ(s21_deq.at(4), 5);
+    EXPECT_THROW(s21_deq.at(5), std::out_of_range);
+    s21_deq.front() = 10;
+    EXPECT_EQ(*s21_deq.begin(), 10);
+}
+
+TEST(DequeTests, MatchesStdDequeAcrossBlocks) {
+    containers::deque<std::string> s21_deq;
+    std::deque<std::string> std_deq;
+    std::mt19937 random(5);
+    for (int i = 0; i < 20000; ++i) {
+        std::string value = std::to_string(i);
+        switch (random() % 7) {
+            case 0:
+            case 1:
+                s21_deq.push_back(value);
+                std_deq.push_back(value);
+                break;
+            case 2:
+            case 3:
+                s21_deq.emplace_front(value);
+                std_deq.emplace_front(value);
+                break;
+            case 4:
+                s21_deq.pop_front();
+                if (!std_deq.empty()) std_deq.pop_front();
+                break;
+            case 5:
+                s21_deq.pop_back();
+                if (!std_deq.empty()) std_deq.pop_back();
+                break;
+            default:
+                s21_deq.push_back(std::move(value));
+                std_deq.push_back(std::to_string(i));
+        }
+        ASSERT_EQ(s21_deq.size(), std_deq.size());
+    }
+    EXPECT_TRUE(std::equal(s21_deq.begin(), s21_deq.end(), std_deq.begin(), std_deq.end()));
+    for (size_t i = 0; i < std_deq.size(); i += 97) EXPECT_EQ(s21_deq[i], std_deq[i]);
+}
+
+TEST(DequeTests, ReferencesStayValidAtBothEnds) {
+    containers::deque<int> s21_deq;
+    s21_deq.push_back(1);
+    int *first = &s21_deq.front();
+    for (int i = 0; i < 10000; ++i) {
+        s21_deq.push_back(i);
+        s21_deq.push_front(-i);
+    }
+    EXPECT_EQ(*first, 1);
+    EXPECT_EQ(&s21_deq[10000], first);
+}
+
+TEST(DequeTests, QueueDriftsThroughTheMap) {
+    // a queue keeps moving to the right, the map must recenter rather than grow without bound
+    containers::deque<long> s21_deq;
+    for (long i = 0; i < 100; ++i) s21_deq.push_back(i);
+    for (long i = 100; i < 200000; ++i) {
+        s21_deq.push_back(i);
+        ASSERT_EQ(s21_deq.front(), i - 100);
+        s21_deq.pop_front();
+    }
+    EXPECT_EQ(s21_deq.size(), 100U);
+    EXPECT_EQ(s21_deq.back(), 199999);
+    s21_deq.shrink_to_fit();
+    EXPECT_EQ(s21_deq.front(), 199900);
+    s21_deq.push_front(7);
+    EXPECT_EQ(s21_deq.end() - s21_deq.begin(), 101);
+}
+
+TEST(DequeTests, IteratorsAreRandomAccess) {
+    containers::deque<int> s21_deq;
+    for (int i = 0; i < 300; ++i) s21_deq.push_front(i);
+    std::sort(s21_deq.begin(), s21_deq.end());
+    EXPECT_EQ(s21_deq.front(), 0);
+    EXPECT_EQ(s21_deq.back(), 299);
+    EXPECT_EQ(s21_deq.begin()[150], 150);
+    containers::deque<int>::const_iterator it = s21_deq.begin() + 200;
+    EXPECT_EQ(*it, 200);
+    EXPECT_TRUE(s21_deq.cbegin() < it);
+    EXPECT_EQ(s21_deq.cend() - it, 100);
+}
+
+TEST(DequeTests, CopyMoveSwapAndClear) {
+    containers::deque<std::string> s21_deq1 = {"a", "b", "c"};
+    s21_deq1.push_front("z");
+    containers::deque<std::string> s21_deq2(s21_deq1);
+    EXPECT_TRUE(std::equal(s21_deq1.begin(), s21_deq1.end(), s21_deq2.begin(), s21_deq2.end()));
+    containers::deque<std::string> s21_deq3(std::move(s21_deq1));
+    EXPECT_TRUE(s21_deq1.empty());
+    EXPECT_EQ(s21_deq3.front(), "z");
+    s21_deq1 = s21_deq3;
+    EXPECT_EQ(s21_deq1.size(), 4U);
+    s21_deq2 = {"x"};
+    s21_deq1.swap(s21_deq2);
+    EXPECT_EQ(s21_deq1.size(), 1U);
+    EXPECT_EQ(s21_deq2.back(), "c");
+    s21_deq2.clear();
+    EXPECT_TRUE(s21_deq2.empty());
+    s21_deq2.push_back("y");
+    EXPECT_EQ(s21_deq2.front(), "y");
+}
+
+TEST(DequeTests, ThrowingConstructorKeepsTheDeque) {
+    struct Fragile {
+        explicit Fragile(int v) : value(v) {
+            if (v < 0) throw std::invalid_argument("invalid_argument");
+        }
+        int value;
+    };
+    containers::deque<Fragile> s21_deq;
+    for (int i = 0; i < 64; ++i) s21_deq.emplace_back(i);
+    EXPECT_THROW(s21_deq.emplace_back(-1), std::invalid_argument);
+    EXPECT_THROW(s21_deq.emplace_front(-1), std::invalid_argument);
+    EXPECT_EQ(s21_deq.size(), 64U);
+    EXPECT_EQ(s21_deq.back().value, 63);
+    EXPECT_EQ(s21_deq.front().value, 0);
+}
+
+TEST(DequeTests, MoveOnlyElements) {
+    containers::deque<std::unique_ptr<int>> s21_deq;
+    for (int i = 0; i < 100; ++i) s21_deq.emplace_back(new int(i));
+    s21_deq.push_front(std::make_unique<int>(-1));
+    EXPECT_EQ(*s21_deq.front(), -1);
+    EXPECT_EQ(*s21_deq.back(), 99);
+}
+
+TEST(DequeTests, StackAndQueueBackend) {
+    containers::stack<int, containers::deque<int>> s21_s;
+    containers::queue<int, containers::deque<int>> s21_q;
+    for (int i = 0; i < 1000; ++i) {
+        s21_s.push(i);
+        s21_q.emplace(i);
+    }
+    EXPECT_EQ(s21_s.top(), 999);
+    EXPECT_EQ(s21_q.front(), 0);
+    EXPECT_EQ(s21_q.back(), 999);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(s21_s.top(), 999 - i);
+        ASSERT_EQ(s21_q.front(), i);
+        s21_s.pop();
+        s21_q.pop();
+    }
+    EXPECT_TRUE(s21_s.empty());
+    EXPECT_TRUE(s21_q.empty());
+}
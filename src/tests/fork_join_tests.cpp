@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../library/fork_join.h"
+#include "../library/vector.h"
+
+namespace {
+long Fibonacci(containers::parallel::fork_join_pool &pool, int n) {
+    if (n < 2) return n;
+    long a = 0;
+    long b = 0;
+    pool.invoke([&] { a = Fibonacci(pool, n - 1); }, [&] { b = Fibonacci(pool, n - 2); });
+    return a + b;
+}
+}  // namespace
+
+TEST(ForkJoinTests, InvokeNests) {
+    containers::parallel::fork_join_pool pool(4);
+    EXPECT_EQ(pool.size(), 4U);
+    EXPECT_EQ(Fibonacci(pool, 20), 6765);
+    containers::parallel::fork_join_pool single(1);
+    EXPECT_EQ(Fibonacci(single, 15), 610);
+}
+
+TEST(ForkJoinTests, ParallelForCoversTheRangeOnce) {
+    containers::parallel::fork_join_pool pool(4);
+    std::vector<std::atomic<int>> hits(10007);
+    for (size_t grain : {0, 1, 100, 20000}) {
+        pool.parallel_for(0, hits.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) ++hits[i];
+        }, grain);
+    }
+    for (auto &hit : hits) ASSERT_EQ(hit.load(), 4);
+    pool.parallel_for(5, 5, [](size_t, size_t) { FAIL(); });
+}
+
+TEST(ForkJoinTests, ParallelForOverVector) {
+    containers::parallel::fork_join_pool pool(4);
+    containers::vector<long> s21_vec(100000);
+    for (size_t i = 0; i < s21_vec.size(); ++i) s21_vec[i] = static_cast<long>(i);
+    // uneven work: the cost grows with the index
+    containers::parallel::parallel_for(s21_vec, [](long &item) {
+        long steps = item / 1000;
+        for (long i = 0; i < steps; ++i) item += 1;
+    }, pool);
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        long index = static_cast<long>(i);
+        ASSERT_EQ(s21_vec[i], index + index / 1000);
+    }
+}
+
+TEST(ForkJoinTests, ExceptionsWaitForBothHalves) {
+    containers::parallel::fork_join_pool pool(3);
+    std::atomic<int> finished{0};
+    EXPECT_THROW(pool.parallel_for(0, 1000, [&](size_t begin, size_t end) {
+        if (begin <= 500 && 500 < end) throw std::runtime_error("task");
+        ++finished;
+    }, 10), std::runtime_error);
+    // halving 1000 down to at most 10 gives 128 pieces, the other 127 still ran
+    EXPECT_EQ(finished.load(), 127);
+    std::atomic<long> sum{0};
+    pool.parallel_for(0, 100, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) sum += static_cast<long>(i);
+    });
+    EXPECT_EQ(sum.load(), 4950);
+}
+
+TEST(ForkJoinTests, OutsideCallersTakeTurns) {
+    containers::parallel::fork_join_pool pool(3);
+    std::vector<std::thread> callers;
+    std::atomic<long> total{0};
+    for (int c = 0; c < 3; ++c) {
+        callers.emplace_back([&] {
+            for (int round = 0; round < 5; ++round) {
+                pool.parallel_for(0, 1000, [&](size_t begin, size_t end) {
+                    total += static_cast<long>(end - begin);
+                });
+            }
+        });
+    }
+    for (auto &caller : callers) caller.join();
+    EXPECT_EQ(total.load(), 15000);
+}
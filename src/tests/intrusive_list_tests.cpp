@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../library/intrusive_list.h"
+
+namespace {
+struct Timer {
+    explicit Timer(int deadline = 0) : deadline(deadline) {}
+
+    int deadline;
+    std::string name;
+    containers::intrusive_list_hook wheel_hook;
+    containers::intrusive_list_hook expired_hook;
+};
+
+using timer_list = containers::intrusive_list<Timer, &Timer::wheel_hook>;
+using expired_list = containers::intrusive_list<Timer, &Timer::expired_hook>;
+
+std::vector<int> Deadlines(const timer_list &timers) {
+    std::vector<int> result;
+    for (const Timer &timer : timers) result.push_back(timer.deadline);
+    return result;
+}
+}  // namespace
+
+TEST(IntrusiveListTests, DefaultConstructor) {
+    timer_list s21_lst;
+    EXPECT_TRUE(s21_lst.empty());
+    EXPECT_EQ(s21_lst.size(), 0U);
+    EXPECT_TRUE(s21_lst.begin() == s21_lst.end());
+    EXPECT_THROW(s21_lst.front(), std::out_of_range);
+    EXPECT_THROW(s21_lst.pop_back(), std::out_of_range);
+}
+
+TEST(IntrusiveListTests, PushAndPop) {
+    std::vector<Timer> timers;
+    for (int i = 0; i < 6; ++i) timers.emplace_back(i);
+    timer_list s21_lst;
+    std::list<int> std_lst;
+    for (int i = 0; i < 6; ++i) {
+        if (i % 2) {
+            s21_lst.push_back(timers[i]);
+            std_lst.push_back(i);
+        } else {
+            s21_lst.push_front(timers[i]);
+            std_lst.push_front(i);
+        }
+    }
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_EQ(&s21_lst.front(), &timers[4]);
+    EXPECT_EQ(&s21_lst.back(), &timers[5]);
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end(),
+                           [](const Timer &timer, int value) { return timer.deadline == value; }));
+
+    s21_lst.pop_front();
+    s21_lst.pop_back();
+    EXPECT_FALSE(timers[4].wheel_hook.is_linked());
+    EXPECT_FALSE(timers[5].wheel_hook.is_linked());
+    EXPECT_EQ(Deadlines(s21_lst), (std::vector<int>{2, 0, 1, 3}));
+    s21_lst.clear();
+    EXPECT_TRUE(std::none_of(timers.begin(), timers.end(),
+                             [](const Timer &timer) { return timer.wheel_hook.is_linked(); }));
+}
+
+TEST(IntrusiveListTests, InsertLinkedObjectThrows) {
+    Timer timer(1);
+    timer_list s21_lst1;
+    timer_list s21_lst2;
+    s21_lst1.push_back(timer);
+    EXPECT_THROW(s21_lst2.push_back(timer), std::invalid_argument);
+    EXPECT_TRUE(s21_lst2.empty());
+}
+
+TEST(IntrusiveListTests, EraseAndSelfUnlink) {
+    Timer timers[5] = {Timer(0), Timer(1), Timer(2), Timer(3), Timer(4)};
+    timer_list s21_lst;
+    for (Timer &timer : timers) s21_lst.push_back(timer);
+
+    auto it = s21_lst.erase(timer_list::iterator_to(timers[1]));
+    EXPECT_EQ(&*it, &timers[2]);
+    timers[3].wheel_hook.unlink();
+    timers[3].wheel_hook.unlink();
+    EXPECT_EQ(Deadlines(s21_lst), (std::vector<int>{0, 2, 4}));
+
+    it = s21_lst.erase(s21_lst.begin(), std::prev(s21_lst.end()));
+    EXPECT_EQ(&*it, &timers[4]);
+    EXPECT_EQ(s21_lst.size(), 1U);
+    EXPECT_THROW(s21_lst.erase(s21_lst.end()), std::out_of_range);
+}
+
+TEST(IntrusiveListTests, DestroyedObjectLeavesList) {
+    timer_list s21_lst;
+    Timer first(1);
+    s21_lst.push_back(first);
+    {
+        Timer temporary(2);
+        s21_lst.push_back(temporary);
+        EXPECT_EQ(s21_lst.size(), 2U);
+    }
+    EXPECT_EQ(s21_lst.size(), 1U);
+    EXPECT_EQ(&s21_lst.back(), &first);
+
+    // a copy does not take over the links of the original
+    Timer copy(first);
+    EXPECT_FALSE(copy.wheel_hook.is_linked());
+    copy = first;
+    EXPECT_FALSE(copy.wheel_hook.is_linked());
+}
+
+TEST(IntrusiveListTests, ObjectInTwoLists) {
+    std::vector<Timer> timers;
+    for (int i = 0; i < 4; ++i) timers.emplace_back(i);
+    timer_list wheel;
+    expired_list expired;
+    for (Timer &timer : timers) wheel.push_back(timer);
+    expired.push_back(timers[2]);
+    expired.push_back(timers[0]);
+
+    wheel.erase(timer_list::iterator_to(timers[2]));
+    EXPECT_EQ(Deadlines(wheel), (std::vector<int>{0, 1, 3}));
+    EXPECT_EQ(expired.size(), 2U);
+    EXPECT_EQ(expired.front().deadline, 2);
+    EXPECT_EQ(expired.back().deadline, 0);
+}
+
+TEST(IntrusiveListTests, SpliceMethods) {
+    std::vector<Timer> timers;
+    for (int i = 0; i < 8; ++i) timers.emplace_back(i);
+    timer_list s21_lst1;
+    timer_list s21_lst2;
+    for (int i = 0; i < 4; ++i) s21_lst1.push_back(timers[i]);
+    for (int i = 4; i < 8; ++i) s21_lst2.push_back(timers[i]);
+
+    s21_lst1.splice(std::next(s21_lst1.cbegin()), s21_lst2, timer_list::iterator_to(timers[6]));
+    EXPECT_EQ(Deadlines(s21_lst1), (std::vector<int>{0, 6, 1, 2, 3}));
+    EXPECT_EQ(Deadlines(s21_lst2), (std::vector<int>{4, 5, 7}));
+
+    // moving an element to its own position changes nothing
+    s21_lst1.splice(timer_list::iterator_to(timers[1]), s21_lst1,
+                    timer_list::iterator_to(timers[1]));
+    s21_lst1.splice(timer_list::iterator_to(timers[1]), s21_lst1,
+                    timer_list::iterator_to(timers[6]));
+    EXPECT_EQ(Deadlines(s21_lst1), (std::vector<int>{0, 6, 1, 2, 3}));
+
+    s21_lst1.splice(s21_lst1.cbegin(), s21_lst1, std::next(s21_lst1.cbegin(), 3), s21_lst1.cend());
+    EXPECT_EQ(Deadlines(s21_lst1), (std::vector<int>{2, 3, 0, 6, 1}));
+
+    s21_lst1.splice(s21_lst1.cend(), s21_lst2);
+    EXPECT_TRUE(s21_lst2.empty());
+    EXPECT_EQ(Deadlines(s21_lst1), (std::vector<int>{2, 3, 0, 6, 1, 4, 5, 7}));
+}
+
+TEST(IntrusiveListTests, MoveAndSwap) {
+    std::vector<Timer> timers;
+    for (int i = 0; i < 5; ++i) timers.emplace_back(i);
+    timer_list s21_lst1;
+    for (int i = 0; i < 3; ++i) s21_lst1.push_back(timers[i]);
+
+    timer_list s21_lst2(std::move(s21_lst1));
+    EXPECT_TRUE(s21_lst1.empty());
+    EXPECT_EQ(Deadlines(s21_lst2), (std::vector<int>{0, 1, 2}));
+
+    s21_lst1.push_back(timers[3]);
+    s21_lst1.swap(s21_lst2);
+    EXPECT_EQ(Deadlines(s21_lst1), (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(Deadlines(s21_lst2), (std::vector<int>{3}));
+
+    s21_lst2 = std::move(s21_lst1);
+    EXPECT_TRUE(s21_lst1.empty());
+    EXPECT_FALSE(timers[3].wheel_hook.is_linked());
+    EXPECT_EQ(Deadlines(s21_lst2), (std::vector<int>{0, 1, 2}));
+    // the moved list unlinks its elements when it goes away
+    {
+        timer_list scoped(std::move(s21_lst2));
+    }
+    EXPECT_FALSE(timers[0].wheel_hook.is_linked());
+}
+
+TEST(IntrusiveListTests, ConstIterator) {
+    Timer timers[3] = {Timer(1), Timer(2), Timer(3)};
+    timer_list s21_lst;
+    for (Timer &timer : timers) s21_lst.push_back(timer);
+    const timer_list &s21_const = s21_lst;
+    int sum = 0;
+    for (auto it = s21_const.cbegin(); it != s21_const.cend(); ++it) sum += it->deadline;
+    EXPECT_EQ(sum, 6);
+    timer_list::const_iterator last = --s21_const.end();
+    EXPECT_EQ(last->deadline, 3);
+    EXPECT_TRUE(timer_list::iterator_to(static_cast<const Timer &>(timers[1])) ==
+                std::next(s21_const.begin()));
+}
+
+namespace {
+struct Shape {
+    virtual ~Shape() = default;
+    virtual int area() const = 0;
+
+    containers::intrusive_list_hook hook;
+};
+
+struct Square : Shape {
+    explicit Square(int side) : side(side) {}
+    int area() const override { return side * side; }
+    int side;
+};
+
+struct Rectangle : Shape {
+    Rectangle(int width, int height) : width(width), height(height) {}
+    int area() const override { return width * height; }
+    int width;
+    int height;
+};
+}  // namespace
+
+TEST(IntrusiveListTests, PolymorphicElements) {
+    Square square(3);
+    Rectangle rectangle(2, 5);
+    Square small(1);
+    containers::intrusive_list<Shape, &Shape::hook> s21_lst;
+    s21_lst.push_back(square);
+    s21_lst.push_back(rectangle);
+    s21_lst.push_front(small);
+    std::vector<int> areas;
+    for (const Shape &shape : s21_lst) areas.push_back(shape.area());
+    EXPECT_EQ(areas, std::vector<int>({1, 9, 10}));
+    EXPECT_EQ(&s21_lst.back(), static_cast<Shape *>(&rectangle));
+    EXPECT_EQ(std::next(s21_lst.begin())->area(), 9);
+    s21_lst.pop_front();
+    EXPECT_EQ(s21_lst.front().area(), 9);
+}
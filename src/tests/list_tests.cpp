@@ -1,8 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
 #include <list>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "../library/list.h"
+#include "../library/node_pool.h"
 
 TEST(ListTests, DefaultConstructor) {
     containers::list<int> s21_lst;
@@ -228,6 +237,107 @@ TEST(ListTests, EraseMethod) {
     }
 }
 
+TEST(ListTests, InsertReturnsIterator) {
+    containers::list<int> s21_lst;
+    std::list<int> std_lst;
+    auto s21_it = s21_lst.insert(s21_lst.end(), 2);
+    auto std_it = std_lst.insert(std_lst.end(), 2);
+    EXPECT_EQ(*s21_it, *std_it);
+    s21_it = s21_lst.insert(s21_it, 1);
+    std_it = std_lst.insert(std_it, 1);
+    EXPECT_EQ(s21_it, s21_lst.begin());
+    s21_it = s21_lst.insert(s21_lst.cend(), 4);
+    std_it = std_lst.insert(std_lst.cend(), 4);
+    EXPECT_EQ(*s21_it, 4);
+    s21_it = s21_lst.insert(s21_it, 3);
+    std_it = std_lst.insert(std_it, 3);
+    EXPECT_EQ(*s21_it, *std_it);
+    EXPECT_EQ(*++s21_it, *++std_it);
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+
+    s21_it = s21_lst.insert_many(++s21_lst.cbegin(), 10, 11, 12);
+    std_it = std_lst.insert(++std_lst.cbegin(), {10, 11, 12});
+    EXPECT_EQ(*s21_it, *std_it);
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+}
+
+TEST(ListTests, EraseRange) {
+    containers::list<int> s21_lst = {1, 2, 3, 4, 5, 6};
+    std::list<int> std_lst = {1, 2, 3, 4, 5, 6};
+    auto s21_it = s21_lst.erase(++s21_lst.begin(), --s21_lst.end());
+    auto std_it = std_lst.erase(++std_lst.begin(), --std_lst.end());
+    EXPECT_EQ(*s21_it, *std_it);
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+
+    s21_it = s21_lst.erase(s21_lst.begin());
+    std_it = std_lst.erase(std_lst.begin());
+    EXPECT_EQ(*s21_it, *std_it);
+    EXPECT_EQ(s21_lst.erase(s21_lst.begin(), s21_lst.end()), s21_lst.end());
+    EXPECT_TRUE(s21_lst.empty());
+    EXPECT_THROW(s21_lst.erase(s21_lst.end()), std::out_of_range);
+}
+
+TEST(ListTests, SpliceElementAndRange) {
+    containers::list<int> s21_lst1 = {1, 2, 3};
+    containers::list<int> s21_lst2 = {4, 5, 6, 7};
+    std::list<int> std_lst1 = {1, 2, 3};
+    std::list<int> std_lst2 = {4, 5, 6, 7};
+
+    s21_lst1.splice(s21_lst1.begin(), s21_lst2, ++s21_lst2.begin());
+    std_lst1.splice(std_lst1.begin(), std_lst2, ++std_lst2.begin());
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+    EXPECT_TRUE(std::equal(s21_lst2.begin(), s21_lst2.end(), std_lst2.begin(), std_lst2.end()));
+
+    s21_lst1.splice(s21_lst1.end(), s21_lst2, s21_lst2.begin(), --s21_lst2.end());
+    std_lst1.splice(std_lst1.end(), std_lst2, std_lst2.begin(), --std_lst2.end());
+    EXPECT_EQ(s21_lst1.size(), std_lst1.size());
+    EXPECT_EQ(s21_lst2.size(), std_lst2.size());
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+    EXPECT_TRUE(std::equal(s21_lst2.begin(), s21_lst2.end(), std_lst2.begin(), std_lst2.end()));
+
+    // moving the last element to the front of the same list
+    s21_lst1.splice(s21_lst1.begin(), s21_lst1, --s21_lst1.end());
+    std_lst1.splice(std_lst1.begin(), std_lst1, --std_lst1.end());
+    s21_lst1.splice(s21_lst1.begin(), s21_lst1, s21_lst1.begin());
+    std_lst1.splice(std_lst1.begin(), std_lst1, std_lst1.begin());
+    s21_lst1.splice(++s21_lst1.begin(), s21_lst1, s21_lst1.begin());
+    std_lst1.splice(++std_lst1.begin(), std_lst1, std_lst1.begin());
+    EXPECT_EQ(s21_lst1.size(), std_lst1.size());
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+
+    containers::list<int> s21_empty;
+    s21_empty.splice(s21_empty.end(), s21_lst1);
+    EXPECT_TRUE(s21_lst1.empty());
+    EXPECT_TRUE(std::equal(s21_empty.begin(), s21_empty.end(), std_lst1.begin(), std_lst1.end()));
+}
+
+TEST(ListTests, ConstIterator) {
+    containers::list<int> s21_lst = {1, 2, 3};
+    const containers::list<int> &s21_const = s21_lst;
+    containers::list<int>::const_iterator it = s21_const.begin();
+    EXPECT_EQ(it, s21_lst.begin());
+    EXPECT_EQ(*it++, 1);
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(--s21_const.end(), --s21_lst.end());
+    EXPECT_EQ(std::distance(s21_lst.cbegin(), s21_lst.cend()), 3);
+}
+
+TEST(ListTests, EraseByIteratorDoesNotWalk) {
+    // an LRU cache: lookups move the entry to the front, the oldest entry falls off the back
+    const int count = 200000;
+    containers::list<int> s21_lst;
+    std::vector<containers::list<int>::iterator> entries;
+    for (int i = 0; i < count; ++i) entries.push_back(s21_lst.insert(s21_lst.end(), i));
+    for (int i = count - 1; i >= 0; i -= 2) {
+        s21_lst.splice(s21_lst.begin(), s21_lst, entries[i]);
+    }
+    for (int i = 0; i < count; i += 4) s21_lst.erase(entries[i]);
+    EXPECT_EQ(s21_lst.size(), static_cast<size_t>(count - count / 4));
+    EXPECT_EQ(s21_lst.front(), 1);
+    EXPECT_EQ(s21_lst.back(), count - 2);
+}
+
 TEST(ListTests, SwapMethod) {
     containers::list<int> s21_lst1 = {1, 2, 3};
     containers::list<int> s21_lst2 = {4, 5, 6};
@@ -309,6 +419,119 @@ TEST(ListTests, UniqueMethod) {
     }
 }
 
+TEST(ListTests, MergeSortedLists) {
+    containers::list<int> s21_lst1 = {1, 4, 4, 9};
+    containers::list<int> s21_lst2 = {0, 4, 5, 10, 11};
+    std::list<int> std_lst1 = {1, 4, 4, 9};
+    std::list<int> std_lst2 = {0, 4, 5, 10, 11};
+    s21_lst1.merge(s21_lst2);
+    std_lst1.merge(std_lst2);
+    EXPECT_TRUE(s21_lst2.empty());
+    EXPECT_EQ(s21_lst1.size(), std_lst1.size());
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+
+    // equal elements of other go after the ones already in the list
+    using entry = std::pair<int, char>;
+    auto by_key = [](const entry &left, const entry &right) { return left.first > right.first; };
+    containers::list<entry> s21_lst3 = {{3, 'a'}, {2, 'a'}, {1, 'a'}};
+    containers::list<entry> s21_lst4 = {{3, 'b'}, {1, 'b'}, {0, 'b'}};
+    std::list<entry> std_lst3 = {{3, 'a'}, {2, 'a'}, {1, 'a'}};
+    std::list<entry> std_lst4 = {{3, 'b'}, {1, 'b'}, {0, 'b'}};
+    s21_lst3.merge(s21_lst4, by_key);
+    std_lst3.merge(std_lst4, by_key);
+    EXPECT_TRUE(std::equal(s21_lst3.begin(), s21_lst3.end(), std_lst3.begin(), std_lst3.end()));
+}
+
+TEST(ListTests, MergeBetweenPools) {
+    containers::node_pool pool1;
+    containers::node_pool pool2;
+    containers::list<int, containers::pool_allocator<int>> s21_lst1(
+        (containers::pool_allocator<int>(pool1)));
+    containers::list<int, containers::pool_allocator<int>> s21_lst2(
+        (containers::pool_allocator<int>(pool2)));
+    std::list<int> std_lst1 = {2, 4, 6};
+    std::list<int> std_lst2 = {1, 4, 7};
+    for (int value : std_lst1) s21_lst1.push_back(value);
+    for (int value : std_lst2) s21_lst2.push_back(value);
+    s21_lst1.merge(s21_lst2);
+    std_lst1.merge(std_lst2);
+    EXPECT_TRUE(s21_lst2.empty());
+    EXPECT_EQ(pool2.in_use(), 0U);
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+}
+
+TEST(ListTests, SortMethod) {
+    std::mt19937 random(7);
+    containers::list<int> s21_lst;
+    std::list<int> std_lst;
+    for (int i = 0; i < 10007; ++i) {
+        int value = static_cast<int>(random() % 1000) - 500;
+        s21_lst.push_back(value);
+        std_lst.push_back(value);
+    }
+    auto first = s21_lst.begin();
+    s21_lst.sort();
+    std_lst.sort();
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+    EXPECT_EQ(*--s21_lst.end(), std_lst.back());
+    EXPECT_EQ(*--(--s21_lst.end()), *--(--std_lst.end()));
+    // nodes are relinked, not copied
+    EXPECT_EQ(std::find(s21_lst.begin(), s21_lst.end(), *first), first);
+
+    s21_lst.sort(std::greater<>());
+    std_lst.sort(std::greater<>());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+}
+
+TEST(ListTests, SortIsStable) {
+    using entry = std::pair<int, int>;
+    containers::list<entry> s21_lst;
+    std::list<entry> std_lst;
+    for (int i = 0; i < 1000; ++i) {
+        s21_lst.push_back({(i * 7919) % 13, i});
+        std_lst.push_back({(i * 7919) % 13, i});
+    }
+    auto by_key = [](const entry &left, const entry &right) { return left.first < right.first; };
+    s21_lst.sort(by_key);
+    std_lst.sort(by_key);
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+
+    containers::list<int> s21_small = {2, 1};
+    s21_small.sort();
+    EXPECT_EQ(s21_small.front(), 1);
+    EXPECT_EQ(s21_small.back(), 2);
+}
+
+TEST(ListTests, SortKeepsNodesWhenComparatorThrows) {
+    containers::list<int> s21_lst;
+    for (int i = 0; i < 100; ++i) s21_lst.push_back(100 - i);
+    int calls = 0;
+    auto throwing = [&calls](int left, int right) {
+        if (++calls == 150) throw std::runtime_error("comparison failed");
+        return left < right;
+    };
+    EXPECT_THROW(s21_lst.sort(throwing), std::runtime_error);
+    EXPECT_EQ(s21_lst.size(), 100U);
+    EXPECT_EQ(std::distance(s21_lst.begin(), s21_lst.end()), 100);
+    size_t backwards = 0;
+    for (auto it = s21_lst.end(); it != s21_lst.begin(); --it) ++backwards;
+    EXPECT_EQ(backwards, 100U);
+    s21_lst.sort();
+    int expected = 1;
+    for (int value : s21_lst) EXPECT_EQ(value, expected++);
+}
+
+TEST(ListTests, UniqueWithPredicate) {
+    containers::list<int> s21_lst = {1, 3, 5, 4, 6, 7, 8, 10, 9};
+    std::list<int> std_lst = {1, 3, 5, 4, 6, 7, 8, 10, 9};
+    auto same_parity = [](int left, int right) { return left % 2 == right % 2; };
+    s21_lst.unique(same_parity);
+    std_lst.unique(same_parity);
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+}
+
 TEST(ListTests, ClearMethod) {
     containers::list<int> s21_lst = {1, 2, 3, 4, 5};
     std::list<int> std_lst = {1, 2, 3, 4, 5};
@@ -320,3 +543,152 @@ TEST(ListTests, ClearMethod) {
     EXPECT_TRUE(s21_lst.empty());
     EXPECT_TRUE(std_lst.empty());
 }
+
+TEST(ListTests, PoolAllocatorReusesNodes) {
+    containers::node_pool pool(16);
+    containers::list<int, containers::pool_allocator<int>> s21_lst(
+        (containers::pool_allocator<int>(pool)));
+    std::list<int> std_lst;
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 40; ++i) {
+            s21_lst.push_back(i);
+            std_lst.push_back(i);
+        }
+        for (int i = 0; i < 20; ++i) {
+            s21_lst.pop_front();
+            std_lst.pop_front();
+        }
+    }
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+    // freed nodes are reused instead of taking new blocks
+    EXPECT_EQ(pool.in_use(), s21_lst.size());
+    EXPECT_LE(pool.block_count(), (s21_lst.size() + 20 + 16) / 16 + 1);
+
+    s21_lst.clear();
+    EXPECT_EQ(pool.in_use(), 0U);
+    EXPECT_EQ(pool.block_count(), 0U);
+}
+
+TEST(ListTests, PoolAllocatorSharedPool) {
+    using pool_list = containers::list<std::string, containers::pool_allocator<std::string>>;
+    containers::node_pool pool;
+    containers::pool_allocator<std::string> allocator(pool);
+    pool_list s21_lst1(allocator);
+    pool_list s21_lst2(allocator);
+    std::list<std::string> std_lst1;
+    std::list<std::string> std_lst2;
+    for (int i = 0; i < 5; ++i) {
+        s21_lst1.push_back("first " + std::to_string(i));
+        s21_lst2.push_back("second " + std::to_string(i));
+        std_lst1.push_back("first " + std::to_string(i));
+        std_lst2.push_back("second " + std::to_string(i));
+    }
+    s21_lst1.splice(++s21_lst1.begin(), s21_lst2);
+    std_lst1.splice(++std_lst1.begin(), std_lst2);
+    EXPECT_TRUE(s21_lst2.empty());
+    EXPECT_EQ(s21_lst1.size(), std_lst1.size());
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+    EXPECT_EQ(pool.in_use(), s21_lst1.size());
+
+    // a copy gets a pool of its own
+    pool_list s21_copy(s21_lst1);
+    EXPECT_NE(s21_copy.get_allocator(), s21_lst1.get_allocator());
+    EXPECT_EQ(pool.in_use(), s21_lst1.size());
+    EXPECT_TRUE(std::equal(s21_copy.begin(), s21_copy.end(), std_lst1.begin(), std_lst1.end()));
+}
+
+TEST(ListTests, PoolAllocatorSpliceBetweenPools) {
+    containers::node_pool pool1;
+    containers::node_pool pool2;
+    containers::list<int, containers::pool_allocator<int>> s21_lst1(
+        (containers::pool_allocator<int>(pool1)));
+    containers::list<int, containers::pool_allocator<int>> s21_lst2(
+        (containers::pool_allocator<int>(pool2)));
+    std::list<int> std_lst1 = {1, 2, 3};
+    std::list<int> std_lst2 = {4, 5, 6};
+    for (int value : std_lst1) s21_lst1.push_back(value);
+    for (int value : std_lst2) s21_lst2.push_back(value);
+
+    // the elements are copied into the nodes of the other pool
+    s21_lst1.splice(++s21_lst1.begin(), s21_lst2);
+    std_lst1.splice(++std_lst1.begin(), std_lst2);
+    EXPECT_TRUE(s21_lst2.empty());
+    EXPECT_EQ(pool2.in_use(), 0U);
+    EXPECT_EQ(pool1.in_use(), s21_lst1.size());
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+
+    s21_lst2.push_back(7);
+    std_lst2.push_back(7);
+    s21_lst1.splice(s21_lst1.end(), s21_lst2);
+    std_lst1.splice(std_lst1.end(), std_lst2);
+    EXPECT_EQ(s21_lst1.size(), std_lst1.size());
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+}
+
+namespace {
+// counts the copies made of it, moves are free
+struct CopyCounter {
+    explicit CopyCounter(int value, int *copies) : value(value), copies(copies) {}
+    CopyCounter(const CopyCounter &other) : value(other.value), copies(other.copies) {
+        ++*copies;
+    }
+    CopyCounter(CopyCounter &&other) noexcept = default;
+
+    int value;
+    int *copies;
+};
+}  // namespace
+
+TEST(ListTests, EmplaceBuildsInPlace) {
+    int copies = 0;
+    containers::list<CopyCounter> s21_lst;
+    s21_lst.emplace_back(2, &copies);
+    s21_lst.emplace_front(1, &copies);
+    auto it = s21_lst.emplace(s21_lst.end(), 4, &copies);
+    s21_lst.emplace(it, 3, &copies);
+    s21_lst.push_back(CopyCounter(5, &copies));
+    EXPECT_EQ(copies, 0);
+
+    CopyCounter six(6, &copies);
+    s21_lst.push_front(six);
+    EXPECT_EQ(copies, 1);
+    std::vector<int> values;
+    for (auto &item : s21_lst) values.push_back(item.value);
+    EXPECT_EQ(values, (std::vector<int>{6, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(s21_lst.emplace_back(7, &copies).value, 7);
+}
+
+TEST(ListTests, MoveOnlyElements) {
+    containers::list<std::unique_ptr<int>> s21_lst;
+    s21_lst.push_back(std::make_unique<int>(2));
+    s21_lst.push_front(std::make_unique<int>(1));
+    s21_lst.emplace_back(new int(3));
+    s21_lst.insert_many_back(std::make_unique<int>(4), std::make_unique<int>(5));
+    EXPECT_EQ(s21_lst.size(), 5U);
+    *s21_lst.front() += 10;
+    EXPECT_EQ(*s21_lst.front(), 11);
+    EXPECT_EQ(*s21_lst.back(), 5);
+
+    containers::list<std::unique_ptr<int>> s21_other(std::move(s21_lst));
+    s21_other.sort([](const auto &left, const auto &right) { return *left > *right; });
+    EXPECT_EQ(*s21_other.front(), 11);
+    EXPECT_EQ(*s21_other.back(), 2);
+    s21_lst = std::move(s21_other);
+    s21_lst.erase(s21_lst.begin());
+    EXPECT_EQ(*s21_lst.front(), 5);
+}
+
+TEST(ListTests, MoveOnlySpliceBetweenPools) {
+    using pooled = containers::pool_allocator<std::unique_ptr<int>>;
+    containers::list<std::unique_ptr<int>, pooled> s21_lst1;
+    containers::list<std::unique_ptr<int>, pooled> s21_lst2;
+    s21_lst1.emplace_back(new int(1));
+    s21_lst2.emplace_back(new int(2));
+    s21_lst2.emplace_back(new int(3));
+    // different pools: the elements are moved into new nodes
+    s21_lst1.splice(s21_lst1.end(), s21_lst2);
+    EXPECT_TRUE(s21_lst2.empty());
+    ASSERT_EQ(s21_lst1.size(), 3U);
+    EXPECT_EQ(*s21_lst1.back(), 3);
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../library/mpmc_queue.h"
+
+TEST(MpmcQueueTests, CapacityIsRoundedUp) {
+    containers::mpmc_queue<int> s21_q(5);
+    EXPECT_EQ(s21_q.capacity(), 8U);
+    EXPECT_TRUE(s21_q.empty());
+    EXPECT_THROW(containers::mpmc_queue<int>(1), std::length_error);
+}
+
+TEST(MpmcQueueTests, PushPopInOrder) {
+    containers::mpmc_queue<std::string> s21_q(4);
+    EXPECT_TRUE(s21_q.try_push("a"));
+    std::string b = "b";
+    EXPECT_TRUE(s21_q.try_push(b));
+    EXPECT_TRUE(s21_q.try_emplace(3, 'c'));
+    s21_q.push("d");
+    EXPECT_EQ(s21_q.size(), 4U);
+    EXPECT_FALSE(s21_q.try_push("e"));
+
+    std::string value;
+    s21_q.pop(value);
+    EXPECT_EQ(value, "a");
+    EXPECT_TRUE(s21_q.try_pop(value));
+    EXPECT_EQ(value, "b");
+    EXPECT_TRUE(s21_q.try_push("e"));
+    for (const char *expected : {"ccc", "d", "e"}) {
+        EXPECT_TRUE(s21_q.try_pop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(s21_q.try_pop(value));
+    EXPECT_TRUE(s21_q.empty());
+}
+
+TEST(MpmcQueueTests, BulkOperationsAcrossTheWrap) {
+    containers::mpmc_queue<int> s21_q(8);
+    std::vector<int> input = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::vector<int> output(10);
+    for (int lap = 0; lap < 3; ++lap) {
+        EXPECT_EQ(s21_q.try_push_n(input.begin(), 5), 5U);
+        EXPECT_EQ(s21_q.try_push_n(input.begin() + 5, 5), 3U);
+        EXPECT_EQ(s21_q.try_push_n(input.begin(), 1), 0U);
+        EXPECT_EQ(s21_q.size(), 8U);
+
+        EXPECT_EQ(s21_q.try_pop_n(output.begin(), 6), 6U);
+        EXPECT_EQ(s21_q.try_pop_n(output.begin() + 6, 6), 2U);
+        EXPECT_EQ(s21_q.try_pop_n(output.begin(), 1), 0U);
+        EXPECT_EQ(std::vector<int>(output.begin(), output.begin() + 8),
+                  std::vector<int>(input.begin(), input.begin() + 8));
+        // shift the positions so the next lap wraps in the middle of a batch
+        s21_q.push(0);
+        int value;
+        s21_q.pop(value);
+    }
+}
+
+TEST(MpmcQueueTests, MoveOnlyAndRemainingElements) {
+    auto shared = std::make_shared<int>(7);
+    {
+        containers::mpmc_queue<std::shared_ptr<int>> s21_q(4);
+        s21_q.push(shared);
+        s21_q.push(shared);
+        std::shared_ptr<int> value;
+        s21_q.pop(value);
+        value.reset();
+        s21_q.push(shared);
+        EXPECT_EQ(shared.use_count(), 3);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+
+    containers::mpmc_queue<std::unique_ptr<int>> s21_q(2);
+    s21_q.push(std::make_unique<int>(1));
+    EXPECT_TRUE(s21_q.try_emplace(new int(2)));
+    auto third = std::make_unique<int>(3);
+    EXPECT_FALSE(s21_q.try_push(std::move(third)));
+    EXPECT_NE(third, nullptr);
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(s21_q.try_pop(value));
+    EXPECT_EQ(*value, 1);
+}
+
+namespace {
+// Output iterator that appends to a vector and throws once writes_left runs out.
+struct ThrowingOutput {
+    std::vector<std::shared_ptr<int>> *sink;
+    int *writes_left;
+
+    ThrowingOutput &operator*() { return *this; }
+    ThrowingOutput &operator++() { return *this; }
+    ThrowingOutput &operator=(std::shared_ptr<int> &&value) {
+        if (*writes_left == 0) throw std::runtime_error("write");
+        --*writes_left;
+        sink->push_back(std::move(value));
+        return *this;
+    }
+};
+}  // namespace
+
+TEST(MpmcQueueTests, PopManyIntoThrowingOutput) {
+    auto shared = std::make_shared<int>(7);
+    containers::mpmc_queue<std::shared_ptr<int>> s21_q(4);
+    for (int i = 0; i < 4; ++i) s21_q.push(shared);
+
+    std::vector<std::shared_ptr<int>> sink;
+    int writes_left = 1;
+    EXPECT_THROW(s21_q.try_pop_n(ThrowingOutput{&sink, &writes_left}, 4), std::runtime_error);
+    // one element was written, the other three were destroyed and their cells released
+    EXPECT_EQ(sink.size(), 1U);
+    EXPECT_EQ(shared.use_count(), 2);
+    EXPECT_TRUE(s21_q.empty());
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(s21_q.try_push(shared));
+    EXPECT_FALSE(s21_q.try_push(shared));
+    std::shared_ptr<int> value;
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(s21_q.try_pop(value));
+    EXPECT_FALSE(s21_q.try_pop(value));
+}
+
+TEST(MpmcQueueTests, ProducersAndConsumersThreads) {
+    constexpr long kProducers = 3;
+    constexpr long kConsumers = 3;
+    constexpr long kPerProducer = 5000;
+    containers::mpmc_queue<long> s21_q(32);
+
+    // each value is producer * kPerProducer + sequence number
+    std::vector<std::thread> threads;
+    for (long p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&s21_q, p] {
+            long batch[8];
+            for (long next = 0; next < kPerProducer;) {
+                if (next % 2 == 0) {
+                    s21_q.push(p * kPerProducer + next++);
+                    continue;
+                }
+                long n = kPerProducer - next < 8 ? kPerProducer - next : 8;
+                for (long i = 0; i < n; ++i) batch[i] = p * kPerProducer + next + i;
+                size_t pushed = s21_q.try_push_n(batch, n);
+                if (pushed == 0) std::this_thread::yield();
+                next += pushed;
+            }
+        });
+    }
+    std::vector<long> sums(kConsumers, 0);
+    std::vector<long> counts(kConsumers, 0);
+    std::vector<char> ordered(kConsumers, 1);
+    std::atomic<long> remaining{kProducers * kPerProducer};
+    for (long c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&, c] {
+            // values of one producer must reach any single consumer in the order they were pushed
+            std::vector<long> last(kProducers, -1);
+            long batch[8];
+            while (remaining.load() > 0) {
+                size_t n = s21_q.try_pop_n(batch, 8);
+                if (n == 0) std::this_thread::yield();
+                for (size_t i = 0; i < n; ++i) {
+                    long producer = batch[i] / kPerProducer;
+                    if (batch[i] <= last[producer]) ordered[c] = 0;
+                    last[producer] = batch[i];
+                    sums[c] += batch[i];
+                    ++counts[c];
+                }
+                remaining -= static_cast<long>(n);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+
+    long total = kProducers * kPerProducer;
+    long sum = 0;
+    long count = 0;
+    for (long c = 0; c < kConsumers; ++c) {
+        EXPECT_TRUE(ordered[c]);
+        sum += sums[c];
+        count += counts[c];
+    }
+    EXPECT_EQ(count, total);
+    EXPECT_EQ(sum, total * (total - 1) / 2);
+    EXPECT_TRUE(s21_q.empty());
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../library/array.h"
+#include "../library/parallel.h"
+#include "../library/vector.h"
+
+namespace {
+containers::vector<long> Iota(size_t n) {
+    containers::vector<long> result;
+    result.reserve(n);
+    for (size_t i = 0; i < n; ++i) result.push_back(static_cast<long>(i % 1000) - 500);
+    return result;
+}
+}  // namespace
+
+TEST(ParallelTests, ThreadPoolRunsEveryTask) {
+    containers::parallel::thread_pool pool(4);
+    EXPECT_EQ(pool.size(), 4U);
+    std::vector<std::atomic<int>> hits(1000);
+    for (int round = 0; round < 10; ++round) {
+        pool.run(hits.size(), [&](size_t i) { ++hits[i]; });
+    }
+    for (auto &hit : hits) EXPECT_EQ(hit.load(), 10);
+}
+
+TEST(ParallelTests, ThreadPoolRethrows) {
+    containers::parallel::thread_pool pool(3);
+    EXPECT_THROW(pool.run(100,
+                          [](size_t i) {
+                              if (i == 42) throw std::runtime_error("task");
+                          }),
+                 std::runtime_error);
+    std::atomic<size_t> sum{0};
+    pool.run(100, [&](size_t i) { sum += i; });  // the pool keeps working after an exception
+    EXPECT_EQ(sum.load(), 4950U);
+}
+
+TEST(ParallelTests, NestedRunIsSerial) {
+    containers::parallel::thread_pool pool(4);
+    std::atomic<int> count{0};
+    pool.run(8, [&](size_t) { pool.run(8, [&](size_t) { ++count; }); });
+    EXPECT_EQ(count.load(), 64);
+}
+
+TEST(ParallelTests, PartitionAlignsChunks) {
+    containers::vector<int> s21_vec(100000);
+    for (size_t offset = 0; offset < 3; ++offset) {
+        const int *data = s21_vec.data() + offset;
+        size_t n = s21_vec.size() - offset;
+        auto chunks = containers::parallel::detail::make_partition(data, n, 8);
+        EXPECT_EQ(chunks.begin(0), 0U);
+        EXPECT_EQ(chunks.end(chunks.count - 1), n);
+        for (size_t chunk = 1; chunk < chunks.count; ++chunk) {
+            EXPECT_EQ(chunks.begin(chunk), chunks.end(chunk - 1));
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(data + chunks.begin(chunk)) % 64, 0U);
+        }
+    }
+}
+
+TEST(ParallelTests, ForEach) {
+    containers::parallel::thread_pool pool(4);
+    containers::vector<long> s21_vec = Iota(100000);
+    std::vector<long> std_vec(s21_vec.data(), s21_vec.data() + s21_vec.size());
+    containers::parallel::for_each(s21_vec, [](long &item) { item *= 3; }, pool);
+    for (auto &item : std_vec) item *= 3;
+    for (size_t i = 0; i < std_vec.size(); ++i) ASSERT_EQ(s21_vec[i], std_vec[i]);
+}
+
+TEST(ParallelTests, Transform) {
+    containers::parallel::thread_pool pool(4);
+    containers::vector<long> s21_in = Iota(70001);
+    containers::vector<double> s21_out(70001);
+    containers::parallel::transform(s21_in, s21_out, [](long item) { return item * 0.5; }, pool);
+    for (size_t i = 0; i < s21_in.size(); ++i) ASSERT_EQ(s21_out[i], s21_in[i] * 0.5);
+
+    containers::vector<double> s21_short(10);
+    auto half = [](long item) { return item * 0.5; };
+    EXPECT_THROW(containers::parallel::transform(s21_in, s21_short, half),
+                 std::length_error);
+}
+
+TEST(ParallelTests, Reduce) {
+    containers::parallel::thread_pool pool(4);
+    containers::vector<long> s21_vec = Iota(123457);
+    std::vector<long> std_vec(s21_vec.data(), s21_vec.data() + s21_vec.size());
+    EXPECT_EQ(containers::parallel::reduce(s21_vec, 7L, std::plus<>(), pool),
+              std::accumulate(std_vec.begin(), std_vec.end(), 7L));
+
+    // non-commutative operation, chunks must be combined in order
+    containers::vector<std::string> s21_words(50000);
+    std::string expected;
+    for (size_t i = 0; i < s21_words.size(); ++i) {
+        s21_words[i] = std::string(1, static_cast<char>('a' + i % 26));
+        expected += s21_words[i];
+    }
+    EXPECT_EQ(containers::parallel::reduce(s21_words, std::string(), std::plus<>(), pool), expected);
+
+    containers::vector<long> s21_empty;
+    EXPECT_EQ(containers::parallel::reduce(s21_empty, 5L), 5L);
+}
+
+TEST(ParallelTests, InclusiveScan) {
+    containers::parallel::thread_pool pool(4);
+    containers::vector<long> s21_vec = Iota(200003);
+    std::vector<long> std_vec(s21_vec.data(), s21_vec.data() + s21_vec.size());
+    std::partial_sum(std_vec.begin(), std_vec.end(), std_vec.begin());
+    containers::parallel::inclusive_scan(s21_vec, s21_vec, std::plus<>(), pool);  // in place
+    for (size_t i = 0; i < std_vec.size(); ++i) ASSERT_EQ(s21_vec[i], std_vec[i]);
+}
+
+TEST(ParallelTests, ArrayContainer) {
+    containers::array<int, 5> s21_arr{1, 2, 3, 4, 5};
+    containers::parallel::for_each(s21_arr, [](int &item) { item += 1; });
+    EXPECT_EQ(containers::parallel::reduce(s21_arr, 0), 20);
+    containers::parallel::inclusive_scan(s21_arr, s21_arr);
+    EXPECT_EQ(s21_arr[4], 20);
+}
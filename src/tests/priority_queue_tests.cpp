@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../library/circular_buffer.h"
+#include "../library/priority_queue.h"
+#include "../library/vector.h"
+
+TEST(PriorityQueueTests, DefaultConstructor) {
+    containers::priority_queue<int> s21_pq;
+    std::priority_queue<int> std_pq;
+    EXPECT_TRUE(s21_pq.empty());
+    EXPECT_EQ(s21_pq.size(), std_pq.size());
+}
+
+TEST(PriorityQueueTests, InitializerListConstructor) {
+    containers::priority_queue<int> s21_pq = {3, 1, 4, 1, 5, 9, 2, 6};
+    std::priority_queue<int> std_pq;
+    for (int value : {3, 1, 4, 1, 5, 9, 2, 6}) std_pq.push(value);
+    EXPECT_EQ(s21_pq.size(), std_pq.size());
+    while (!std_pq.empty()) {
+        EXPECT_EQ(s21_pq.top(), std_pq.top());
+        s21_pq.pop();
+        std_pq.pop();
+    }
+    EXPECT_TRUE(s21_pq.empty());
+}
+
+template <size_t Arity>
+void MatchesStdPriorityQueue() {
+    containers::priority_queue<int, containers::vector<int>, std::greater<int>, Arity> s21_pq;
+    std::priority_queue<int, std::vector<int>, std::greater<int>> std_pq;
+    std::mt19937 random(Arity);
+    for (int i = 0; i < 5000; ++i) {
+        int value = static_cast<int>(random() % 1000);
+        switch (random() % 4) {
+            case 0:
+            case 1:
+                s21_pq.push(value);
+                std_pq.push(value);
+                break;
+            case 2:
+                if (!std_pq.empty()) {
+                    s21_pq.pop();
+                    std_pq.pop();
+                }
+                break;
+            default:
+                // on an empty queue pop_push is a push
+                s21_pq.pop_push(value);
+                if (!std_pq.empty()) std_pq.pop();
+                std_pq.push(value);
+        }
+        ASSERT_EQ(s21_pq.size(), std_pq.size());
+        if (!std_pq.empty()) {
+            ASSERT_EQ(s21_pq.top(), std_pq.top());
+        }
+    }
+}
+
+TEST(PriorityQueueTests, BinaryHeapMatchesStd) { MatchesStdPriorityQueue<2>(); }
+
+TEST(PriorityQueueTests, QuaternaryHeapMatchesStd) { MatchesStdPriorityQueue<4>(); }
+
+TEST(PriorityQueueTests, OddArityMatchesStd) { MatchesStdPriorityQueue<3>(); }
+
+TEST(PriorityQueueTests, PushRange) {
+    containers::priority_queue<int> s21_pq = {50, 10};
+    std::vector<int> many(1000);
+    for (int i = 0; i < 1000; ++i) many[i] = (i * 7919) % 1000;
+    s21_pq.push_range(many);  // rebuilds the heap
+    s21_pq.push_range(std::vector<int>{2000, -1});  // sifts the two elements up
+    EXPECT_EQ(s21_pq.size(), 1004U);
+    int previous = s21_pq.top();
+    EXPECT_EQ(previous, 2000);
+    while (!s21_pq.empty()) {
+        EXPECT_LE(s21_pq.top(), previous);
+        previous = s21_pq.top();
+        s21_pq.pop();
+    }
+    EXPECT_EQ(previous, -1);
+}
+
+TEST(PriorityQueueTests, EmplaceAndMoveOnlyElements) {
+    auto compare = [](const std::unique_ptr<int> &a, const std::unique_ptr<int> &b) {
+        return *a < *b;
+    };
+    containers::priority_queue<std::unique_ptr<int>, containers::vector<std::unique_ptr<int>>,
+                               decltype(compare)>
+        s21_pq(compare);
+    for (int value : {4, 8, 1, 6}) s21_pq.emplace(new int(value));
+    s21_pq.push(std::make_unique<int>(7));
+    EXPECT_EQ(*s21_pq.top(), 8);
+    s21_pq.pop_push(std::make_unique<int>(5));
+    for (int expected : {7, 6, 5, 4, 1}) {
+        EXPECT_EQ(*s21_pq.top(), expected);
+        s21_pq.pop();
+    }
+}
+
+TEST(PriorityQueueTests, CopyMoveAndSwap) {
+    containers::priority_queue<std::string> s21_pq1 = {"b", "d", "a"};
+    containers::priority_queue<std::string> s21_pq2(s21_pq1);
+    EXPECT_EQ(s21_pq2.top(), "d");
+    containers::priority_queue<std::string> s21_pq3(std::move(s21_pq1));
+    EXPECT_EQ(s21_pq3.size(), 3U);
+    s21_pq1 = s21_pq3;
+    s21_pq1.pop();
+    EXPECT_EQ(s21_pq1.top(), "b");
+    s21_pq1.swap(s21_pq2);
+    EXPECT_EQ(s21_pq1.size(), 3U);
+    EXPECT_EQ(s21_pq2.size(), 2U);
+    s21_pq2 = std::move(s21_pq1);
+    EXPECT_EQ(s21_pq2.top(), "d");
+}
+
+TEST(PriorityQueueTests, OtherContainer) {
+    containers::priority_queue<int, containers::circular_buffer<int>, std::less<int>, 2> s21_pq;
+    for (int i = 0; i < 100; ++i) s21_pq.push((i * 37) % 100);
+    for (int expected = 99; expected >= 0; --expected) {
+        EXPECT_EQ(s21_pq.top(), expected);
+        s21_pq.pop();
+    }
+}
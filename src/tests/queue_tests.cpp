@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <queue>
 
 #include "../library/queue.h"
@@ -173,4 +174,25 @@ TEST(QueueTests, SwapMethod) {
     EXPECT_EQ(s21_q2.front(), std_q2.front());
     EXPECT_EQ(s21_q1.back(), std_q1.back());
     EXPECT_EQ(s21_q2.back(), std_q2.back());
-}
\ No newline at end of file
+}
+
+TEST(QueueTests, EmplaceAndMoveOnly) {
+    containers::queue<std::unique_ptr<int>> s21_q;
+    std::queue<std::unique_ptr<int>> std_q;
+    s21_q.push(std::make_unique<int>(1));
+    std_q.push(std::make_unique<int>(1));
+    EXPECT_EQ(*s21_q.emplace(new int(2)), 2);
+    std_q.emplace(new int(2));
+    EXPECT_EQ(s21_q.size(), std_q.size());
+    EXPECT_EQ(*s21_q.front(), *std_q.front());
+    EXPECT_EQ(*s21_q.back(), *std_q.back());
+
+    std::unique_ptr<int> first = std::move(s21_q.front());
+    s21_q.pop();
+    EXPECT_EQ(*first, 1);
+    EXPECT_EQ(*s21_q.front(), 2);
+
+    containers::queue<std::unique_ptr<int>> s21_moved(std::move(s21_q));
+    EXPECT_EQ(s21_moved.size(), 1U);
+    EXPECT_TRUE(s21_q.empty());
+}
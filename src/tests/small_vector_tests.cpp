@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../library/small_vector.h"
+#include "../library/stack.h"
+
+TEST(SmallVectorTests, DefaultConstructor) {
+    containers::small_vector<int, 8> s21_vec;
+    EXPECT_TRUE(s21_vec.empty());
+    EXPECT_EQ(s21_vec.size(), 0U);
+    EXPECT_EQ(s21_vec.capacity(), 8U);
+    EXPECT_EQ(s21_vec.begin(), s21_vec.end());
+}
+
+TEST(SmallVectorTests, SizeConstructor) {
+    containers::small_vector<int, 4> s21_inline(3);
+    containers::small_vector<int, 4> s21_heap(10);
+    std::vector<int> std_vec(10);
+
+    EXPECT_EQ(s21_inline.size(), 3U);
+    EXPECT_EQ(s21_inline.capacity(), 4U);
+    EXPECT_EQ(s21_heap.size(), std_vec.size());
+    EXPECT_EQ(s21_heap.capacity(), std_vec.capacity());
+    EXPECT_THROW((containers::small_vector<int, 4>(-1)), std::length_error);
+}
+
+TEST(SmallVectorTests, InitializerListConstructor) {
+    containers::small_vector<int, 8> s21_vec = {1, 2, 3, 4, 5};
+    std::vector<int> std_vec = {1, 2, 3, 4, 5};
+
+    EXPECT_EQ(s21_vec.size(), std_vec.size());
+    EXPECT_EQ(s21_vec.capacity(), 8U);
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(SmallVectorTests, PushBackSpillsToHeap) {
+    containers::small_vector<std::string, 4> s21_vec;
+    std::vector<std::string> std_vec;
+
+    for (int i = 0; i < 4; ++i) {
+        s21_vec.push_back(std::to_string(i));
+        std_vec.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(s21_vec.capacity(), 4U);
+
+    for (int i = 4; i < 20; ++i) {
+        s21_vec.emplace_back(std::to_string(i));
+        std_vec.emplace_back(std::to_string(i));
+    }
+    EXPECT_GT(s21_vec.capacity(), 4U);
+
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(SmallVectorTests, ElementAccess) {
+    containers::small_vector<int, 4> s21_vec{1, 2, 3};
+    EXPECT_EQ(s21_vec.data(), &s21_vec[0]);
+    EXPECT_THROW(s21_vec.at(3), std::out_of_range);
+    EXPECT_DEATH(s21_vec[3], "out of range");
+}
+
+TEST(SmallVectorTests, Iterators) {
+    containers::small_vector<int, 4> s21_vec{3, 1, 2};
+    std::vector<int> std_vec{3, 1, 2};
+    std::sort(s21_vec.begin(), s21_vec.end());
+    std::sort(std_vec.begin(), std_vec.end());
+    EXPECT_TRUE(std::equal(s21_vec.cbegin(), s21_vec.cend(), std_vec.begin(), std_vec.end()));
+    auto it = s21_vec.insert(s21_vec.cend() - 1, 10);
+    std_vec.insert(std_vec.cend() - 1, 10);
+    EXPECT_EQ(it - s21_vec.begin(), 2);
+    EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), std_vec.begin(), std_vec.end()));
+}
+
+TEST(SmallVectorTests, CopyAndMove) {
+    containers::small_vector<std::string, 4> s21_small = {"a", "b"};
+    containers::small_vector<std::string, 4> s21_large = {"a", "b", "c", "d", "e", "f"};
+
+    containers::small_vector<std::string, 4> s21_copy_small(s21_small);
+    containers::small_vector<std::string, 4> s21_copy_large(s21_large);
+    EXPECT_EQ(s21_copy_small.size(), 2U);
+    EXPECT_EQ(s21_copy_large.size(), 6U);
+    EXPECT_EQ(s21_copy_large[5], "f");
+
+    containers::small_vector<std::string, 4> s21_move_small(std::move(s21_copy_small));
+    containers::small_vector<std::string, 4> s21_move_large(std::move(s21_copy_large));
+    EXPECT_TRUE(s21_copy_small.empty());
+    EXPECT_TRUE(s21_copy_large.empty());
+    EXPECT_EQ(s21_move_small[1], "b");
+    EXPECT_EQ(s21_move_large[5], "f");
+
+    s21_move_small = s21_large;
+    EXPECT_EQ(s21_move_small.size(), 6U);
+    s21_move_large = std::move(s21_small);
+    EXPECT_EQ(s21_move_large.size(), 2U);
+    EXPECT_EQ(s21_move_large[0], "a");
+    EXPECT_EQ(s21_move_large.capacity(), 4U);
+}
+
+TEST(SmallVectorTests, InsertAndErase) {
+    containers::small_vector<int, 4> s21_vec = {1, 2, 4};
+    std::vector<int> std_vec = {1, 2, 4};
+
+    s21_vec.insert(s21_vec.begin() + 2, 3);
+    std_vec.insert(std_vec.begin() + 2, 3);
+    s21_vec.insert(s21_vec.begin(), 0);
+    std_vec.insert(std_vec.begin(), 0);
+    s21_vec.erase(s21_vec.begin() + 1);
+    std_vec.erase(std_vec.begin() + 1);
+    std::vector<int> source = {7, 8, 9};
+    s21_vec.insert(s21_vec.end(), source.begin(), source.end());
+    std_vec.insert(std_vec.end(), source.begin(), source.end());
+
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+    EXPECT_THROW(s21_vec.at(100), std::out_of_range);
+}
+
+TEST(SmallVectorTests, InsertMany) {
+    containers::small_vector<int, 8> s21_vec = {1, 2, 5};
+    std::vector<int> std_vec = {1, 2, 5};
+
+    s21_vec.insert_many(s21_vec.begin() + 2, 3, 4);
+    std_vec.insert(std_vec.begin() + 2, {3, 4});
+    s21_vec.insert_many_back(6, 7, 8);
+    std_vec.insert(std_vec.end(), {6, 7, 8});
+    s21_vec.insert_many_front(-1, 0);
+    std_vec.insert(std_vec.begin(), {-1, 0});
+
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(SmallVectorTests, InsertManyOwnElements) {
+    containers::small_vector<int, 8> s21_vec = {10, 20, 30};
+    s21_vec.insert_many(s21_vec.begin(), s21_vec[1], s21_vec[2]);
+    std::vector<int> expected = {20, 30, 10, 20, 30};
+    EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), expected.begin(), expected.end()));
+
+    // and while spilling to the heap
+    containers::small_vector<std::string, 3> s21_strings = {"a", "b", "c"};
+    s21_strings.insert_many(s21_strings.begin() + 1, s21_strings[2], s21_strings[0]);
+    std::vector<std::string> expected_strings = {"a", "c", "a", "b", "c"};
+    EXPECT_TRUE(std::equal(s21_strings.begin(), s21_strings.end(), expected_strings.begin(),
+                           expected_strings.end()));
+}
+
+TEST(SmallVectorTests, Swap) {
+    containers::small_vector<std::string, 3> s21_inline = {"a", "b"};
+    containers::small_vector<std::string, 3> s21_heap = {"c", "d", "e", "f"};
+    containers::small_vector<std::string, 3> s21_other_heap = {"g", "h", "i", "j", "k"};
+
+    s21_inline.swap(s21_heap);
+    ASSERT_EQ(s21_inline.size(), 4U);
+    ASSERT_EQ(s21_heap.size(), 2U);
+    EXPECT_EQ(s21_inline[0], "c");
+    EXPECT_EQ(s21_heap[1], "b");
+
+    s21_inline.swap(s21_other_heap);
+    EXPECT_EQ(s21_inline.size(), 5U);
+    EXPECT_EQ(s21_other_heap.size(), 4U);
+    EXPECT_EQ(s21_inline[4], "k");
+}
+
+TEST(SmallVectorTests, ShrinkToFitReturnsInline) {
+    containers::small_vector<int, 4> s21_vec = {1, 2, 3, 4, 5, 6};
+    s21_vec.pop_back();
+    s21_vec.pop_back();
+    s21_vec.pop_back();
+    s21_vec.shrink_to_fit();
+
+    EXPECT_EQ(s21_vec.capacity(), 4U);
+    ASSERT_EQ(s21_vec.size(), 3U);
+    EXPECT_EQ(s21_vec.front(), 1);
+    EXPECT_EQ(s21_vec.back(), 3);
+
+    s21_vec.reserve(100);
+    EXPECT_EQ(s21_vec.capacity(), 100U);
+    s21_vec.clear();
+    EXPECT_TRUE(s21_vec.empty());
+}
+
+namespace {
+// Copy-only element whose copy constructor throws once copies_left runs out.
+struct ThrowingCopy {
+    static inline int copies_left = -1;
+    int value;
+    ThrowingCopy(int v) : value(v) {}
+    ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+        if (copies_left == 0) throw std::runtime_error("copy");
+        if (copies_left > 0) --copies_left;
+    }
+    ThrowingCopy &operator=(const ThrowingCopy &other) = default;
+};
+}  // namespace
+
+TEST(SmallVectorTests, ThrowingCopyKeepsTheElements) {
+    containers::small_vector<ThrowingCopy, 4> s21_vec;
+    for (int i = 0; i < 4; ++i) s21_vec.emplace_back(i);
+    auto unchanged = [&] {
+        ASSERT_EQ(s21_vec.size(), 4U);
+        for (int i = 0; i < 4; ++i) ASSERT_EQ(s21_vec[i].value, i);
+    };
+    // spilling the inline elements to the heap
+    ThrowingCopy::copies_left = 2;
+    EXPECT_THROW(s21_vec.emplace_back(4), std::runtime_error);
+    unchanged();
+    ThrowingCopy::copies_left = 1;
+    EXPECT_THROW(s21_vec.reserve(16), std::runtime_error);
+    unchanged();
+    ThrowingCopy::copies_left = -1;
+    s21_vec.reserve(16);
+    // there is room, the copy past the end that opens the gap throws
+    ThrowingCopy::copies_left = 1;
+    EXPECT_THROW(s21_vec.emplace(s21_vec.begin(), 9), std::runtime_error);
+    unchanged();
+    ThrowingCopy::copies_left = -1;
+    s21_vec.erase(s21_vec.begin());
+    s21_vec.emplace(s21_vec.begin(), 0);
+    unchanged();
+
+    // shifting in place keeps the elements inline while they fit
+    containers::small_vector<ThrowingCopy, 8> s21_inline;
+    for (int i = 0; i < 4; ++i) s21_inline.emplace_back(i);
+    const ThrowingCopy *data = s21_inline.data();
+    s21_inline.insert(s21_inline.begin(), ThrowingCopy(9));
+    EXPECT_EQ(s21_inline.data(), data);
+    EXPECT_EQ(s21_inline.capacity(), 8U);
+    int expected[] = {9, 0, 1, 2, 3};
+    ASSERT_EQ(s21_inline.size(), 5U);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(s21_inline[i].value, expected[i]);
+}
+
+TEST(SmallVectorTests, StackBackingContainer) {
+    containers::stack<int, containers::small_vector<int, 4>> s21_s;
+    for (int i = 0; i < 10; ++i) s21_s.push(i);
+    EXPECT_EQ(s21_s.size(), 10U);
+    EXPECT_EQ(s21_s.top(), 9);
+    s21_s.pop();
+    EXPECT_EQ(s21_s.top(), 8);
+
+    containers::stack<int, containers::small_vector<int, 4>> s21_copy(s21_s);
+    EXPECT_EQ(s21_copy.top(), 8);
+    containers::stack<int, containers::small_vector<int, 4>> s21_other;
+    s21_other.push(42);
+    s21_other.swap(s21_copy);
+    EXPECT_EQ(s21_other.size(), 9U);
+    EXPECT_EQ(s21_copy.top(), 42);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../library/array.h"
+#include "../library/sort.h"
+#include "../library/vector.h"
+
+namespace {
+// Inputs that trip up quicksort variants: random, sorted, reversed, all equal, organ pipe, few
+// distinct values and sorted with noise.
+template <typename T>
+std::vector<std::vector<T>> Patterns(size_t n) {
+    std::mt19937_64 gen(21);
+    std::vector<std::vector<T>> patterns(7, std::vector<T>(n));
+    for (size_t i = 0; i < n; ++i) {
+        patterns[0][i] = static_cast<T>(gen());
+        patterns[1][i] = static_cast<T>(i);
+        patterns[2][i] = static_cast<T>(n - i);
+        patterns[3][i] = static_cast<T>(7);
+        patterns[4][i] = static_cast<T>(i < n / 2 ? i : n - i);
+        patterns[5][i] = static_cast<T>(gen() % 4);
+        patterns[6][i] = static_cast<T>(i % 100 == 0 ? gen() % n : i);
+    }
+    return patterns;
+}
+
+template <typename T>
+containers::vector<T> ToVector(const std::vector<T> &items) {
+    containers::vector<T> result;
+    result.reserve(items.size());
+    for (const T &item : items) result.push_back(item);
+    return result;
+}
+
+template <typename T, typename Compare = std::less<>>
+void CheckSort(size_t n, containers::parallel::thread_pool &pool, Compare comp = Compare()) {
+    for (std::vector<T> &std_vec : Patterns<T>(n)) {
+        containers::vector<T> s21_vec = ToVector(std_vec);
+        containers::sort(s21_vec, comp, pool);
+        std::sort(std_vec.begin(), std_vec.end(), comp);
+        ASSERT_EQ(s21_vec.size(), std_vec.size());
+        for (size_t i = 0; i < std_vec.size(); ++i) ASSERT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+}  // namespace
+
+TEST(SortTests, RadixIntegers) {
+    containers::parallel::thread_pool pool(1);
+    CheckSort<int32_t>(1000, pool);
+    CheckSort<int64_t>(1000, pool);
+    CheckSort<uint64_t>(1000, pool);
+    CheckSort<int16_t>(1000, pool);
+    CheckSort<uint8_t>(1000, pool);
+    CheckSort<int32_t>(1000, pool, std::greater<>());
+}
+
+TEST(SortTests, RadixFloats) {
+    containers::parallel::thread_pool pool(1);
+    std::vector<double> std_vec{3.5, -0.0, -2.25, 1e300, -1e-300, 0.0, -7.0, 2.0};
+    for (int i = 0; i < 200; ++i) std_vec.push_back((i % 2 ? -1 : 1) * i * 0.37);
+    containers::vector<double> s21_vec = ToVector(std_vec);
+    containers::sort(s21_vec, std::less<>(), pool);
+    std::sort(std_vec.begin(), std_vec.end());
+    for (size_t i = 0; i < std_vec.size(); ++i) EXPECT_EQ(s21_vec[i], std_vec[i]);
+
+    std::vector<float> expected(70);
+    for (size_t i = 0; i < expected.size(); ++i) expected[i] = static_cast<float>(i) - 35.5f;
+    containers::vector<float> s21_floats = ToVector(expected);
+    std::reverse(s21_floats.data(), s21_floats.data() + s21_floats.size());
+    containers::sort(s21_floats, std::less<float>(), pool);
+    for (size_t i = 0; i < expected.size(); ++i) EXPECT_EQ(s21_floats[i], expected[i]);
+}
+
+TEST(SortTests, StableRadixKeepsSignedZeroOrder) {
+    containers::parallel::thread_pool pool(1);
+    std::vector<double> std_vec;
+    for (int i = 0; i < 100; ++i) std_vec.push_back(i % 2 ? -0.0 : 0.0);
+    containers::vector<double> s21_vec = ToVector(std_vec);
+    containers::stable_sort(s21_vec, std::less<>(), pool);
+    for (size_t i = 0; i < std_vec.size(); ++i) {
+        EXPECT_EQ(std::signbit(s21_vec[i]), std::signbit(std_vec[i]));
+    }
+}
+
+TEST(SortTests, Pdqsort) {
+    containers::parallel::thread_pool pool(1);
+    auto by_remainder = [](int a, int b) {
+        return a % 1000 < b % 1000 || (a % 1000 == b % 1000 && a < b);
+    };
+    CheckSort<int>(5000, pool, by_remainder);
+    CheckSort<int>(5000, pool, std::greater<>());  // through radix
+    CheckSort<int>(20, pool, [](int a, int b) { return a > b; });
+
+    containers::vector<std::string> s21_vec{"pear", "apple", "fig", "banana", "kiwi", "cherry"};
+    std::vector<std::string> std_vec{"pear", "apple", "fig", "banana", "kiwi", "cherry"};
+    containers::sort(s21_vec);
+    std::sort(std_vec.begin(), std_vec.end());
+    for (size_t i = 0; i < std_vec.size(); ++i) EXPECT_EQ(s21_vec[i], std_vec[i]);
+}
+
+TEST(SortTests, StableSort) {
+    containers::parallel::thread_pool pool(1);
+    std::mt19937 gen(5);
+    std::vector<std::pair<int, int>> std_vec;
+    for (int i = 0; i < 3000; ++i) std_vec.emplace_back(static_cast<int>(gen() % 50), i);
+    containers::vector<std::pair<int, int>> s21_vec = ToVector(std_vec);
+    auto by_key = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+        return a.first < b.first;
+    };
+    containers::stable_sort(s21_vec, by_key, pool);
+    std::stable_sort(std_vec.begin(), std_vec.end(), by_key);
+    for (size_t i = 0; i < std_vec.size(); ++i) EXPECT_EQ(s21_vec[i], std_vec[i]);
+}
+
+TEST(SortTests, ParallelRadix) {
+    containers::parallel::thread_pool pool(4);
+    CheckSort<int64_t>(70001, pool);
+    CheckSort<uint32_t>(70001, pool, std::greater<uint32_t>());
+}
+
+TEST(SortTests, ParallelComparisonSort) {
+    containers::parallel::thread_pool pool(3);  // odd run count exercises the unpaired run
+    CheckSort<int64_t>(70001, pool, [](int64_t a, int64_t b) { return a < b; });
+
+    std::mt19937 gen(7);
+    std::vector<std::pair<int, int>> std_vec;
+    for (int i = 0; i < 70000; ++i) std_vec.emplace_back(static_cast<int>(gen() % 1000), i);
+    containers::vector<std::pair<int, int>> s21_vec = ToVector(std_vec);
+    auto by_key = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+        return a.first < b.first;
+    };
+    containers::stable_sort(s21_vec, by_key, pool);
+    std::stable_sort(std_vec.begin(), std_vec.end(), by_key);
+    for (size_t i = 0; i < std_vec.size(); ++i) ASSERT_EQ(s21_vec[i], std_vec[i]);
+}
+
+TEST(SortTests, ArrayContainer) {
+    containers::array<int, 6> s21_arr{5, -1, 4, 4, 0, 9};
+    std::array<int, 6> std_arr{5, -1, 4, 4, 0, 9};
+    containers::sort(s21_arr);
+    std::sort(std_arr.begin(), std_arr.end());
+    for (size_t i = 0; i < std_arr.size(); ++i) EXPECT_EQ(s21_arr[i], std_arr[i]);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../library/spsc_queue.h"
+
+TEST(SpscQueueTests, CapacityIsRoundedUp) {
+    containers::spsc_queue<int> s21_q(5);
+    EXPECT_EQ(s21_q.capacity(), 8U);
+    EXPECT_TRUE(s21_q.empty());
+    EXPECT_THROW(containers::spsc_queue<int>(0), std::length_error);
+}
+
+TEST(SpscQueueTests, PushPopInOrder) {
+    containers::spsc_queue<std::string> s21_q(4);
+    EXPECT_TRUE(s21_q.try_push("a"));
+    std::string b = "b";
+    EXPECT_TRUE(s21_q.try_push(b));
+    EXPECT_TRUE(s21_q.try_emplace(3, 'c'));
+    s21_q.push("d");
+    EXPECT_EQ(s21_q.size(), 4U);
+    EXPECT_FALSE(s21_q.try_push("e"));
+
+    EXPECT_EQ(s21_q.front(), "a");
+    s21_q.pop();
+    std::string value;
+    EXPECT_TRUE(s21_q.try_pop(value));
+    EXPECT_EQ(value, "b");
+    EXPECT_TRUE(s21_q.try_pop(value));
+    EXPECT_EQ(value, "ccc");
+    EXPECT_TRUE(s21_q.try_push("e"));
+    EXPECT_TRUE(s21_q.try_pop(value));
+    EXPECT_EQ(value, "d");
+    EXPECT_TRUE(s21_q.try_pop(value));
+    EXPECT_EQ(value, "e");
+    EXPECT_FALSE(s21_q.try_pop(value));
+    EXPECT_TRUE(s21_q.empty());
+}
+
+TEST(SpscQueueTests, BatchOperations) {
+    containers::spsc_queue<int> s21_q(8);
+    std::vector<int> input = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    EXPECT_EQ(s21_q.try_push_n(input.begin(), 5), 5U);
+    EXPECT_EQ(s21_q.try_push_n(input.begin() + 5, 5), 3U);
+    EXPECT_EQ(s21_q.try_push_n(input.begin(), 1), 0U);
+
+    std::vector<int> output(10);
+    EXPECT_EQ(s21_q.try_pop_n(output.begin(), 6), 6U);
+    EXPECT_EQ(s21_q.try_pop_n(output.begin() + 6, 6), 2U);
+    EXPECT_EQ(s21_q.try_pop_n(output.begin(), 1), 0U);
+    EXPECT_EQ(std::vector<int>(output.begin(), output.begin() + 8),
+              std::vector<int>(input.begin(), input.begin() + 8));
+}
+
+TEST(SpscQueueTests, DestroysRemainingElements) {
+    auto shared = std::make_shared<int>(7);
+    {
+        containers::spsc_queue<std::shared_ptr<int>> s21_q(4);
+        s21_q.push(shared);
+        s21_q.push(shared);
+        s21_q.pop();
+        s21_q.push(shared);
+        EXPECT_EQ(shared.use_count(), 3);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(SpscQueueTests, MoveOnlyElements) {
+    containers::spsc_queue<std::unique_ptr<int>> s21_q(2);
+    s21_q.push(std::make_unique<int>(1));
+    auto second = std::make_unique<int>(2);
+    EXPECT_TRUE(s21_q.try_push(std::move(second)));
+    auto third = std::make_unique<int>(3);
+    EXPECT_FALSE(s21_q.try_push(std::move(third)));
+    EXPECT_NE(third, nullptr);
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(s21_q.try_pop(value));
+    EXPECT_EQ(*value, 1);
+}
+
+TEST(SpscQueueTests, ProducerAndConsumerThreads) {
+    constexpr long kCount = 20000;
+    containers::spsc_queue<long> s21_q(64);
+    std::thread producer([&] {
+        long batch[16];
+        long next = 0;
+        while (next < kCount) {
+            if (next % 3 == 0) {
+                s21_q.push(next++);
+                continue;
+            }
+            long n = kCount - next < 16 ? kCount - next : 16;
+            for (long i = 0; i < n; ++i) batch[i] = next + i;
+            next += s21_q.try_push_n(batch, n);
+        }
+    });
+    long expected = 0;
+    bool ordered = true;
+    long batch[16];
+    while (expected < kCount) {
+        size_t n = s21_q.try_pop_n(batch, 16);
+        for (size_t i = 0; i < n; ++i) ordered &= batch[i] == expected++;
+        if (n == 0) std::this_thread::yield();
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(s21_q.empty());
+}
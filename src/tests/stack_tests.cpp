@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <stack>
+#include <string>
+#include <utility>
 
 #include "../library/stack.h"
 #include "../library/vector.h"
@@ -165,4 +168,25 @@ TEST(StackTests, SwapMethod) {
 
     EXPECT_EQ(s21_s1.top(), std_s1.top());
     EXPECT_EQ(s21_s2.top(), std_s2.top());
-}
\ No newline at end of file
+}
+
+TEST(StackTests, EmplaceAndMoveOnly) {
+    containers::stack<std::unique_ptr<std::string>> s21_s;
+    std::stack<std::unique_ptr<std::string>> std_s;
+    s21_s.push(std::make_unique<std::string>("a"));
+    std_s.push(std::make_unique<std::string>("a"));
+    EXPECT_EQ(*s21_s.emplace(new std::string("b")), "b");
+    std_s.emplace(new std::string("b"));
+    EXPECT_EQ(s21_s.size(), std_s.size());
+    EXPECT_EQ(*s21_s.top(), *std_s.top());
+
+    std::unique_ptr<std::string> top = std::move(s21_s.top());
+    s21_s.pop();
+    EXPECT_EQ(*top, "b");
+    EXPECT_EQ(*s21_s.top(), "a");
+
+    containers::stack<std::pair<int, std::string>> s21_pairs;
+    s21_pairs.emplace(1, "one");
+    s21_pairs.top().second += "!";
+    EXPECT_EQ(s21_pairs.top().second, "one!");
+}
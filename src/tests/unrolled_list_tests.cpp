@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../library/node_pool.h"
+#include "../library/unrolled_list.h"
+
+TEST(UnrolledListTests, DefaultConstructor) {
+    containers::unrolled_list<int> s21_lst;
+    EXPECT_TRUE(s21_lst.empty());
+    EXPECT_EQ(s21_lst.size(), 0U);
+    EXPECT_TRUE(s21_lst.begin() == s21_lst.end());
+}
+
+TEST(UnrolledListTests, SizeConstructor) {
+    containers::unrolled_list<int, 4> s21_lst(10);
+    std::list<int> std_lst(10);
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+}
+
+TEST(UnrolledListTests, InitializerListConstructor) {
+    containers::unrolled_list<int, 4> s21_lst = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::list<int> std_lst = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+    EXPECT_EQ(s21_lst.front(), 1);
+    EXPECT_EQ(s21_lst.back(), 9);
+}
+
+TEST(UnrolledListTests, CopyAndMove) {
+    containers::unrolled_list<std::string, 4> s21_lst1 = {"a", "b", "c", "d", "e", "f"};
+    containers::unrolled_list<std::string, 4> s21_lst2(s21_lst1);
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), s21_lst2.begin(), s21_lst2.end()));
+
+    containers::unrolled_list<std::string, 4> s21_lst3(std::move(s21_lst1));
+    EXPECT_TRUE(s21_lst1.empty());
+    EXPECT_TRUE(std::equal(s21_lst2.begin(), s21_lst2.end(), s21_lst3.begin(), s21_lst3.end()));
+
+    s21_lst1 = std::move(s21_lst3);
+    EXPECT_TRUE(s21_lst3.empty());
+    EXPECT_EQ(s21_lst1.size(), 6U);
+    EXPECT_EQ(s21_lst1.back(), "f");
+
+    s21_lst1 = {"x", "y"};
+    EXPECT_EQ(s21_lst1.size(), 2U);
+    EXPECT_EQ(s21_lst1.front(), "x");
+}
+
+TEST(UnrolledListTests, PushAndPopBothEnds) {
+    containers::unrolled_list<int, 4> s21_lst;
+    std::list<int> std_lst;
+    for (int i = 0; i < 50; ++i) {
+        if (i % 3 == 0) {
+            s21_lst.push_front(i);
+            std_lst.push_front(i);
+        } else {
+            s21_lst.push_back(i);
+            std_lst.push_back(i);
+        }
+    }
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+    for (int i = 0; i < 20; ++i) {
+        s21_lst.pop_front();
+        std_lst.pop_front();
+        s21_lst.pop_back();
+        std_lst.pop_back();
+    }
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+    EXPECT_EQ(s21_lst.front(), std_lst.front());
+    EXPECT_EQ(s21_lst.back(), std_lst.back());
+
+    while (!s21_lst.empty()) s21_lst.pop_back();
+    EXPECT_THROW(s21_lst.pop_back(), std::out_of_range);
+    EXPECT_THROW(s21_lst.pop_front(), std::out_of_range);
+    EXPECT_THROW(s21_lst.front(), std::out_of_range);
+    EXPECT_THROW(s21_lst.back(), std::out_of_range);
+}
+
+TEST(UnrolledListTests, InsertSplitsFullNodes) {
+    containers::unrolled_list<int, 4> s21_lst = {0, 1, 2, 3};
+    std::list<int> std_lst = {0, 1, 2, 3};
+    auto s21_it = s21_lst.insert(std::next(s21_lst.begin(), 3), 10);
+    auto std_it = std_lst.insert(std::next(std_lst.begin(), 3), 10);
+    EXPECT_EQ(*s21_it, 10);
+    s21_it = s21_lst.insert(std::next(s21_lst.begin()), 11);
+    std_it = std_lst.insert(std::next(std_lst.begin()), 11);
+    EXPECT_EQ(*s21_it, 11);
+    EXPECT_EQ(*std::prev(s21_it), *std::prev(std_it));
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+}
+
+TEST(UnrolledListTests, InsertElementOfItself) {
+    containers::unrolled_list<std::string, 4> s21_lst = {"a", "b", "c"};
+    s21_lst.insert(s21_lst.begin(), s21_lst.back());
+    s21_lst.insert(s21_lst.end(), s21_lst.front());
+    containers::unrolled_list<std::string, 4> expected = {"c", "a", "b", "c", "c"};
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), expected.begin(), expected.end()));
+}
+
+TEST(UnrolledListTests, RandomInsertAndErase) {
+    containers::unrolled_list<int, 8> s21_lst;
+    std::list<int> std_lst;
+    std::mt19937 random(7);
+    for (int i = 0; i < 3000; ++i) {
+        size_t at = s21_lst.empty() ? 0 : random() % (s21_lst.size() + 1);
+        if (s21_lst.empty() || random() % 3 != 0) {
+            auto s21_it = s21_lst.insert(std::next(s21_lst.begin(), at), i);
+            std_lst.insert(std::next(std_lst.begin(), at), i);
+            EXPECT_EQ(*s21_it, i);
+        } else {
+            if (at == s21_lst.size()) --at;
+            auto s21_it = s21_lst.erase(std::next(s21_lst.begin(), at));
+            auto std_it = std_lst.erase(std::next(std_lst.begin(), at));
+            EXPECT_EQ(s21_it == s21_lst.end(), std_it == std_lst.end());
+            if (std_it != std_lst.end()) {
+                EXPECT_EQ(*s21_it, *std_it);
+            }
+        }
+    }
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+    EXPECT_TRUE(std::equal(std_lst.rbegin(), std_lst.rend(),
+                           std::make_reverse_iterator(s21_lst.end()),
+                           std::make_reverse_iterator(s21_lst.begin())));
+}
+
+namespace {
+// Copy-only element whose copy constructor throws once copies_left runs out.
+struct ThrowingCopy {
+    static inline int copies_left = -1;
+    int value;
+    ThrowingCopy(int v) : value(v) {}
+    ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+        if (copies_left == 0) throw std::runtime_error("copy");
+        if (copies_left > 0) --copies_left;
+    }
+    ThrowingCopy &operator=(const ThrowingCopy &other) = default;
+    bool operator==(int other) const { return value == other; }
+};
+}  // namespace
+
+TEST(UnrolledListTests, CopyOnlyElements) {
+    // elements without a noexcept move are shifted by assignment, never lost on a throw
+    containers::unrolled_list<ThrowingCopy, 8> s21_lst;
+    std::list<int> std_lst;
+    std::mt19937 random(3);
+    for (int i = 0; i < 1000; ++i) {
+        size_t at = s21_lst.empty() ? 0 : random() % (s21_lst.size() + 1);
+        if (s21_lst.empty() || random() % 3 != 0) {
+            s21_lst.insert(std::next(s21_lst.begin(), at), ThrowingCopy(i));
+            std_lst.insert(std::next(std_lst.begin(), at), i);
+        } else {
+            if (at == s21_lst.size()) --at;
+            s21_lst.erase(std::next(s21_lst.begin(), at));
+            std_lst.erase(std::next(std_lst.begin(), at));
+        }
+    }
+    ThrowingCopy::copies_left = 1;
+    EXPECT_THROW(s21_lst.insert(std::next(s21_lst.begin()), ThrowingCopy(-1)), std::runtime_error);
+    ThrowingCopy::copies_left = -1;
+    EXPECT_EQ(s21_lst.size(), std_lst.size());
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+}
+
+TEST(UnrolledListTests, EraseRange) {
+    containers::unrolled_list<int, 4> s21_lst;
+    std::list<int> std_lst;
+    for (int i = 0; i < 30; ++i) {
+        s21_lst.push_back(i);
+        std_lst.push_back(i);
+    }
+    auto s21_it = s21_lst.erase(std::next(s21_lst.begin(), 3), std::next(s21_lst.begin(), 21));
+    auto std_it = std_lst.erase(std::next(std_lst.begin(), 3), std::next(std_lst.begin(), 21));
+    EXPECT_EQ(*s21_it, *std_it);
+    EXPECT_TRUE(std::equal(s21_lst.begin(), s21_lst.end(), std_lst.begin(), std_lst.end()));
+    EXPECT_THROW(s21_lst.erase(s21_lst.end()), std::out_of_range);
+
+    s21_it = s21_lst.erase(s21_lst.begin(), s21_lst.end());
+    EXPECT_TRUE(s21_it == s21_lst.end());
+    EXPECT_TRUE(s21_lst.empty());
+}
+
+TEST(UnrolledListTests, SwapMethod) {
+    containers::unrolled_list<int, 4> s21_lst1 = {1, 2, 3, 4, 5};
+    containers::unrolled_list<int, 4> s21_lst2 = {6};
+    s21_lst1.swap(s21_lst2);
+    EXPECT_EQ(s21_lst1.size(), 1U);
+    EXPECT_EQ(s21_lst1.front(), 6);
+    EXPECT_EQ(s21_lst2.size(), 5U);
+    EXPECT_EQ(s21_lst2.back(), 5);
+
+    containers::unrolled_list<int, 4> s21_empty;
+    s21_empty.swap(s21_lst2);
+    EXPECT_TRUE(s21_lst2.empty());
+    EXPECT_EQ(s21_empty.size(), 5U);
+}
+
+TEST(UnrolledListTests, SpliceMethod) {
+    containers::unrolled_list<int, 4> s21_lst1 = {1, 2, 3, 4, 5, 6};
+    containers::unrolled_list<int, 4> s21_lst2 = {10, 20, 30, 40, 50};
+    std::list<int> std_lst1 = {1, 2, 3, 4, 5, 6};
+    std::list<int> std_lst2 = {10, 20, 30, 40, 50};
+    s21_lst1.splice(std::next(s21_lst1.cbegin(), 1), s21_lst2);
+    std_lst1.splice(std::next(std_lst1.cbegin(), 1), std_lst2);
+    EXPECT_TRUE(s21_lst2.empty());
+    EXPECT_EQ(s21_lst1.size(), std_lst1.size());
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+
+    containers::unrolled_list<int, 4> s21_lst3 = {7, 8};
+    std::list<int> std_lst3 = {7, 8};
+    s21_lst1.splice(s21_lst1.cend(), s21_lst3);
+    std_lst1.splice(std_lst1.cend(), std_lst3);
+    EXPECT_TRUE(std::equal(s21_lst1.begin(), s21_lst1.end(), std_lst1.begin(), std_lst1.end()));
+}
+
+TEST(UnrolledListTests, ConstIterator) {
+    const containers::unrolled_list<int, 4> s21_lst = {1, 2, 3, 4, 5, 6, 7};
+    int sum = 0;
+    for (auto it = s21_lst.cbegin(); it != s21_lst.cend(); ++it) sum += *it;
+    EXPECT_EQ(sum, 28);
+    containers::unrolled_list<int, 4>::const_iterator last = --s21_lst.end();
+    EXPECT_EQ(*last, 7);
+    EXPECT_EQ(std::distance(s21_lst.begin(), s21_lst.end()), 7);
+}
+
+TEST(UnrolledListTests, NodesStayDense) {
+    containers::node_pool pool;
+    containers::unrolled_list<int, 16, containers::pool_allocator<int>> s21_lst(
+        (containers::pool_allocator<int>(pool)));
+    for (int i = 0; i < 1600; ++i) s21_lst.push_back(i);
+    EXPECT_EQ(pool.in_use(), 100U);
+    // erasing every other element folds half-empty nodes into their neighbours
+    for (auto it = s21_lst.begin(); it != s21_lst.end();) {
+        it = s21_lst.erase(it);
+        if (it != s21_lst.end()) ++it;
+    }
+    EXPECT_EQ(s21_lst.size(), 800U);
+    EXPECT_LE(pool.in_use(), 800U / 4);
+    int expected = 1;
+    for (int value : s21_lst) {
+        EXPECT_EQ(value, expected);
+        expected += 2;
+    }
+    s21_lst.clear();
+    EXPECT_EQ(pool.in_use(), 0U);
+    EXPECT_EQ(pool.block_count(), 0U);
+}
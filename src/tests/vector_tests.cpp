@@ -1,8 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+#include "../library/mmap_allocator.h"
 #include "../library/vector.h"
 
 TEST(VectorTests, DefaultConstructor) {
@@ -129,6 +140,101 @@ TEST(VectorTests, OperatorSquareBrackets) {
     EXPECT_EQ(s21_vec[4], std_vec[4]);
 }
 
+TEST(VectorTests, CheckedOperatorSquareBrackets) {
+    // the test build has no NDEBUG, so operator[] checks the index
+    containers::vector<int> s21_vec{1, 2, 3};
+    const containers::vector<int> &s21_const = s21_vec;
+    EXPECT_DEATH(s21_vec[3], "out of range");
+    EXPECT_DEATH(s21_const[10], "out of range");
+    EXPECT_THROW(s21_const.at(3), std::out_of_range);
+    EXPECT_EQ(s21_const.at(2), 3);
+}
+
+TEST(VectorTests, DataMethod) {
+    containers::vector<int> s21_vec{1, 2, 3};
+    std::vector<int> std_vec{1, 2, 3};
+    s21_vec.data()[1] = 20;
+    std_vec.data()[1] = 20;
+    const containers::vector<int> &s21_const = s21_vec;
+    EXPECT_EQ(s21_const.data(), &s21_vec[0]);
+    for (size_t i = 0; i < std_vec.size(); ++i) EXPECT_EQ(s21_const.data()[i], std_vec.data()[i]);
+}
+
+TEST(VectorTests, IteratorTraits) {
+    using iterator = containers::vector<int>::iterator;
+    using const_iterator = containers::vector<int>::const_iterator;
+    using traits = std::iterator_traits<iterator>;
+    EXPECT_TRUE((std::is_same_v<traits::iterator_category, std::random_access_iterator_tag>));
+    EXPECT_TRUE((std::is_same_v<traits::value_type, int>));
+    EXPECT_TRUE((std::is_same_v<traits::difference_type, std::ptrdiff_t>));
+    EXPECT_TRUE((std::is_same_v<traits::reference, int &>));
+    EXPECT_TRUE((std::is_same_v<std::iterator_traits<const_iterator>::value_type, int>));
+    EXPECT_TRUE((std::is_same_v<std::iterator_traits<const_iterator>::reference, const int &>));
+    EXPECT_TRUE((std::is_convertible_v<iterator, const_iterator>));
+    EXPECT_FALSE((std::is_convertible_v<const_iterator, iterator>));
+}
+
+TEST(VectorTests, IteratorArithmetic) {
+    containers::vector<int> s21_vec{1, 2, 3, 4, 5};
+    std::vector<int> std_vec{1, 2, 3, 4, 5};
+    auto s21_it = s21_vec.begin();
+    auto std_it = std_vec.begin();
+    EXPECT_EQ(*s21_it++, *std_it++);
+    EXPECT_EQ(*s21_it, *std_it);
+    s21_it += 2;
+    std_it += 2;
+    EXPECT_EQ(*s21_it, *std_it);
+    EXPECT_EQ(s21_it[-1], std_it[-1]);
+    EXPECT_EQ(*(1 + s21_vec.begin()), *(1 + std_vec.begin()));
+    EXPECT_EQ(*s21_it--, *std_it--);
+    s21_it -= 1;
+    std_it -= 1;
+    EXPECT_EQ(*s21_it, *std_it);
+    EXPECT_EQ(s21_vec.end() - s21_vec.begin(), std_vec.end() - std_vec.begin());
+    EXPECT_EQ(s21_vec.end() - s21_it, std_vec.end() - std_it);
+    EXPECT_TRUE(s21_vec.begin() <= s21_it && s21_it < s21_vec.end());
+    EXPECT_EQ(s21_it - s21_vec.cbegin(), 1);
+}
+
+TEST(VectorTests, ConstIterator) {
+    containers::vector<std::string> s21_vec{"one", "two", "three"};
+    const containers::vector<std::string> &s21_const = s21_vec;
+    containers::vector<std::string>::const_iterator first = s21_const.begin();
+    EXPECT_EQ(first, s21_vec.cbegin());
+    EXPECT_EQ(s21_const.end(), s21_vec.end());
+    EXPECT_EQ(first->size(), 3U);
+    EXPECT_EQ(*std::find(s21_vec.cbegin(), s21_vec.cend(), "two"), "two");
+
+    // positions of the modifiers take const iterators
+    auto it = s21_vec.insert(s21_vec.cbegin() + 1, "zero");
+    EXPECT_EQ(it - s21_vec.begin(), 1);
+    it = s21_vec.erase(s21_vec.cend() - 1);
+    EXPECT_EQ(it, s21_vec.end());
+    s21_vec.emplace(s21_vec.cend(), 4, 'x');
+    std::vector<std::string> std_vec{"one", "zero", "two", "xxxx"};
+    EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), std_vec.begin(), std_vec.end()));
+}
+
+TEST(VectorTests, StandardAlgorithms) {
+    containers::vector<int> s21_vec{5, 3, 9, 1, 7, 3};
+    std::vector<int> std_vec{5, 3, 9, 1, 7, 3};
+    std::sort(s21_vec.begin(), s21_vec.end());
+    std::sort(std_vec.begin(), std_vec.end());
+    EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), std_vec.begin(), std_vec.end()));
+    EXPECT_EQ(std::lower_bound(s21_vec.begin(), s21_vec.end(), 5) - s21_vec.begin(),
+              std::lower_bound(std_vec.begin(), std_vec.end(), 5) - std_vec.begin());
+    EXPECT_EQ(std::accumulate(s21_vec.cbegin(), s21_vec.cend(), 0),
+              std::accumulate(std_vec.cbegin(), std_vec.cend(), 0));
+    std::reverse(s21_vec.begin(), s21_vec.end());
+    std::reverse(std_vec.begin(), std_vec.end());
+
+    std::vector<int> copy(s21_vec.size());
+    std::copy(s21_vec.cbegin(), s21_vec.cend(), copy.begin());
+    EXPECT_EQ(copy, std_vec);
+    std::vector<int> from_range(s21_vec.begin(), s21_vec.end());
+    EXPECT_EQ(from_range, std_vec);
+}
+
 TEST(VectorTests, PushBack) {
     containers::vector<int> s21_vec;
     std::vector<int> std_vec;
@@ -351,6 +457,23 @@ TEST(VectorTests, InsertMany) {
     }
 }
 
+TEST(VectorTests, InsertManyOwnElements) {
+    containers::vector<int> s21_vec{10, 20, 30};
+    s21_vec.reserve(10);
+    s21_vec.insert_many(s21_vec.begin(), s21_vec[1], s21_vec[2]);
+    containers::vector<int> expected{20, 30, 10, 20, 30};
+    EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), expected.begin(), expected.end()));
+
+    // and while growing
+    containers::vector<std::string> s21_strings{"a", "b", "c"};
+    s21_strings.shrink_to_fit();
+    s21_strings.insert_many(s21_strings.begin() + 1, s21_strings[2], std::string("x"),
+                            s21_strings[0]);
+    containers::vector<std::string> expected_strings{"a", "c", "x", "a", "b", "c"};
+    EXPECT_TRUE(std::equal(s21_strings.begin(), s21_strings.end(), expected_strings.begin(),
+                           expected_strings.end()));
+}
+
 TEST(VectorTests, InsertManyBack) {
     containers::vector<int> s21_vec = {1, 2};
     std::vector<int> std_vec = {1, 2};
@@ -375,4 +498,421 @@ TEST(VectorTests, InsertManyFront) {
     for (size_t i = 0; i < s21_vec.size(); ++i) {
         EXPECT_EQ(s21_vec[i], std_vec[i]);
     }
-}
\ No newline at end of file
+}
+
+TEST(VectorTests, EraseMethod) {
+    containers::vector<int> s21_vec = {1, 2, 3, 4, 5};
+    std::vector<int> std_vec = {1, 2, 3, 4, 5};
+
+    auto s21_it = s21_vec.erase(s21_vec.begin() + 1);
+    auto std_it = std_vec.erase(std_vec.begin() + 1);
+    EXPECT_EQ(*s21_it, *std_it);
+
+    s21_vec.erase(s21_vec.end() - 1);
+    std_vec.erase(std_vec.end() - 1);
+
+    EXPECT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+    EXPECT_THROW(s21_vec.erase(s21_vec.end()), std::out_of_range);
+}
+
+TEST(VectorTests, NonTrivialElementsRelocation) {
+    containers::vector<std::string> s21_vec;
+    std::vector<std::string> std_vec;
+
+    for (int i = 0; i < 100; ++i) {
+        std::string value = "a long enough string to skip sso " + std::to_string(i);
+        std_vec.push_back(value);
+        s21_vec.push_back(value);
+    }
+    s21_vec.insert(s21_vec.begin() + 10, s21_vec[50]);
+    std_vec.insert(std_vec.begin() + 10, std_vec[50]);
+    s21_vec.insert(s21_vec.begin(), s21_vec[0]);
+    std_vec.insert(std_vec.begin(), std_vec[0]);
+    s21_vec.erase(s21_vec.begin() + 20);
+    std_vec.erase(std_vec.begin() + 20);
+    s21_vec.insert_many(s21_vec.begin() + 5, std::string("x"), std::string("y"));
+    std_vec.insert(std_vec.begin() + 5, {"x", "y"});
+    s21_vec.reserve(1000);
+    s21_vec.shrink_to_fit();
+
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+
+    s21_vec.clear();
+    EXPECT_TRUE(s21_vec.empty());
+}
+
+struct RelocatableHandle {
+    int *value;
+    RelocatableHandle(int v = 0) : value(new int(v)) {}
+    RelocatableHandle(const RelocatableHandle &other) : value(new int(*other.value)) {}
+    RelocatableHandle &operator=(const RelocatableHandle &other) {
+        *value = *other.value;
+        return *this;
+    }
+    ~RelocatableHandle() { delete value; }
+};
+
+template <>
+struct containers::is_trivially_relocatable<RelocatableHandle> : std::true_type {};
+
+TEST(VectorTests, TriviallyRelocatableTrait) {
+    static_assert(containers::is_trivially_relocatable_v<int>);
+    static_assert(!containers::is_trivially_relocatable_v<std::string>);
+    static_assert(containers::is_trivially_relocatable_v<RelocatableHandle>);
+
+    containers::vector<RelocatableHandle> s21_vec;
+    for (int i = 0; i < 50; ++i) {
+        s21_vec.push_back(RelocatableHandle(i));
+    }
+    s21_vec.insert(s21_vec.begin(), RelocatableHandle(-1));
+    s21_vec.erase(s21_vec.begin() + 10);
+    s21_vec.shrink_to_fit();
+
+    ASSERT_EQ(s21_vec.size(), 50U);
+    EXPECT_EQ(*s21_vec[0].value, -1);
+    for (int i = 1; i < 10; ++i) {
+        EXPECT_EQ(*s21_vec[i].value, i - 1);
+    }
+    for (int i = 10; i < 50; ++i) {
+        EXPECT_EQ(*s21_vec[i].value, i);
+    }
+}
+
+TEST(VectorTests, EmplaceBack) {
+    containers::vector<std::pair<int, std::string>> s21_vec;
+    std::vector<std::pair<int, std::string>> std_vec;
+
+    for (int i = 0; i < 20; ++i) {
+        s21_vec.emplace_back(i, std::to_string(i));
+        std_vec.emplace_back(i, std::to_string(i));
+    }
+    EXPECT_EQ(s21_vec.emplace_back(42, "last").second, "last");
+    std_vec.emplace_back(42, "last");
+
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(VectorTests, Emplace) {
+    containers::vector<std::string> s21_vec = {"a", "b", "c"};
+    std::vector<std::string> std_vec = {"a", "b", "c"};
+
+    s21_vec.emplace(s21_vec.begin() + 1, 3, 'x');
+    std_vec.emplace(std_vec.begin() + 1, 3, 'x');
+    s21_vec.emplace(s21_vec.begin(), s21_vec[3]);
+    std_vec.emplace(std_vec.begin(), std_vec[3]);
+    s21_vec.emplace(s21_vec.end(), "end");
+    std_vec.emplace(std_vec.end(), "end");
+
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(VectorTests, MoveOnlyElements) {
+    containers::vector<std::unique_ptr<int>> s21_vec;
+    for (int i = 0; i < 10; ++i) {
+        s21_vec.push_back(std::make_unique<int>(i));
+    }
+    s21_vec.emplace(s21_vec.begin(), std::make_unique<int>(-1));
+    s21_vec.insert_many(s21_vec.begin() + 1, std::make_unique<int>(100), std::make_unique<int>(101));
+    s21_vec.insert_many_back(std::make_unique<int>(200));
+
+    ASSERT_EQ(s21_vec.size(), 14U);
+    EXPECT_EQ(*s21_vec[0], -1);
+    EXPECT_EQ(*s21_vec[1], 100);
+    EXPECT_EQ(*s21_vec[2], 101);
+    EXPECT_EQ(*s21_vec[3], 0);
+    EXPECT_EQ(*s21_vec[13], 200);
+}
+
+struct CopyCounter {
+    static inline int copies = 0;
+    int value;
+    CopyCounter(int v) : value(v) {}
+    CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+    CopyCounter(CopyCounter &&other) noexcept : value(other.value) {}
+    CopyCounter &operator=(const CopyCounter &other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    CopyCounter &operator=(CopyCounter &&other) noexcept {
+        value = other.value;
+        return *this;
+    }
+};
+
+TEST(VectorTests, InsertManyDoesNotCopy) {
+    containers::vector<CopyCounter> s21_vec;
+    CopyCounter::copies = 0;
+
+    s21_vec.emplace_back(3);
+    s21_vec.insert_many_back(CopyCounter(4), CopyCounter(5));
+    s21_vec.insert_many_front(CopyCounter(1), CopyCounter(2));
+    s21_vec.insert_many(s21_vec.begin() + 2, 10, 11, 12);
+
+    EXPECT_EQ(CopyCounter::copies, 0);
+    ASSERT_EQ(s21_vec.size(), 8U);
+    int expected[] = {1, 2, 10, 11, 12, 3, 4, 5};
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i].value, expected[i]);
+    }
+}
+
+namespace {
+// Copy-only element whose copy constructor throws once copies_left runs out.
+struct ThrowingCopy {
+    static inline int copies_left = -1;
+    int value;
+    ThrowingCopy(int v) : value(v) {}
+    ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+        if (copies_left == 0) throw std::runtime_error("copy");
+        if (copies_left > 0) --copies_left;
+    }
+    ThrowingCopy &operator=(const ThrowingCopy &other) = default;
+};
+}  // namespace
+
+TEST(VectorTests, ThrowingCopyKeepsTheElements) {
+    containers::vector<ThrowingCopy> s21_vec;
+    for (int i = 0; i < 5; ++i) s21_vec.push_back(ThrowingCopy(i));
+    ThrowingCopy::copies_left = -1;
+    s21_vec.reserve(5);
+    size_t capacity = s21_vec.capacity();
+    auto unchanged = [&] {
+        ASSERT_EQ(s21_vec.size(), 5U);
+        for (int i = 0; i < 5; ++i) ASSERT_EQ(s21_vec[i].value, i);
+    };
+
+    ThrowingCopy::copies_left = 2;
+    EXPECT_THROW(s21_vec.reserve(100), std::runtime_error);
+    unchanged();
+    EXPECT_EQ(s21_vec.capacity(), capacity);
+
+    ThrowingCopy::copies_left = -1;
+    s21_vec.shrink_to_fit();
+    ThrowingCopy::copies_left = 3;
+    EXPECT_THROW(s21_vec.insert(s21_vec.begin() + 1, ThrowingCopy(9)), std::runtime_error);
+    unchanged();
+
+    ThrowingCopy::copies_left = -1;
+    s21_vec.reserve(10);
+    ThrowingCopy::copies_left = 2;
+    // there is room, the copy past the end that opens the gap throws
+    EXPECT_THROW(s21_vec.insert_many(s21_vec.begin(), ThrowingCopy(7), ThrowingCopy(8)),
+                 std::runtime_error);
+    unchanged();
+
+    // shifting in place keeps the buffer and references into it
+    ThrowingCopy::copies_left = -1;
+    const ThrowingCopy *data = s21_vec.data();
+    const ThrowingCopy &last = s21_vec[4];
+    s21_vec.insert(s21_vec.begin() + 1, ThrowingCopy(9));
+    EXPECT_EQ(s21_vec.data(), data);
+    EXPECT_EQ(&last, &s21_vec[4]);
+    int expected[] = {0, 9, 1, 2, 3, 4};
+    for (int i = 0; i < 6; ++i) EXPECT_EQ(s21_vec[i].value, expected[i]);
+    s21_vec.erase(s21_vec.begin() + 1);
+    unchanged();
+    // more new elements than elements behind the gap
+    s21_vec.insert_many(s21_vec.begin() + 4, ThrowingCopy(7), ThrowingCopy(8));
+    EXPECT_EQ(s21_vec.data(), data);
+    int more[] = {0, 1, 2, 3, 7, 8, 4};
+    ASSERT_EQ(s21_vec.size(), 7U);
+    for (int i = 0; i < 7; ++i) EXPECT_EQ(s21_vec[i].value, more[i]);
+}
+
+TEST(VectorTests, InsertRange) {
+    containers::vector<int> s21_vec = {1, 2, 3};
+    std::vector<int> std_vec = {1, 2, 3};
+    std::vector<int> source = {10, 11, 12, 13, 14};
+
+    s21_vec.insert(s21_vec.begin() + 1, source.begin(), source.end());
+    std_vec.insert(std_vec.begin() + 1, source.begin(), source.end());
+
+    std::list<int> std_lst = {20, 21};
+    s21_vec.insert(s21_vec.end(), std_lst.begin(), std_lst.end());
+    std_vec.insert(std_vec.end(), std_lst.begin(), std_lst.end());
+
+    containers::vector<int> other = {30, 31, 32};
+    s21_vec.insert(s21_vec.begin(), other.begin(), other.end());
+    std_vec.insert(std_vec.begin(), {30, 31, 32});
+
+    std::istringstream stream("40 41 42");
+    s21_vec.insert(s21_vec.begin() + 2, std::istream_iterator<int>(stream), std::istream_iterator<int>());
+    std_vec.insert(std_vec.begin() + 2, {40, 41, 42});
+
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(VectorTests, InsertRangeReallocatesOnce) {
+    containers::vector<std::string> s21_vec = {"a", "b"};
+    std::vector<std::string> source(100000, "record");
+
+    s21_vec.insert(s21_vec.begin() + 1, source.begin(), source.end());
+
+    EXPECT_EQ(s21_vec.size(), 100002U);
+    EXPECT_EQ(s21_vec.capacity(), 100002U);
+    EXPECT_EQ(s21_vec[0], "a");
+    EXPECT_EQ(s21_vec[1], "record");
+    EXPECT_EQ(s21_vec[100001], "b");
+}
+
+TEST(VectorTests, AppendRange) {
+    containers::vector<int> s21_vec = {1, 2};
+    std::vector<int> source(10000);
+    for (size_t i = 0; i < source.size(); ++i) source[i] = static_cast<int>(i);
+
+    s21_vec.reserve(16);
+    s21_vec.append_range(source);
+
+    ASSERT_EQ(s21_vec.size(), 10002U);
+    EXPECT_EQ(s21_vec.capacity(), 10002U);
+    EXPECT_EQ(s21_vec[1], 2);
+    for (size_t i = 0; i < source.size(); ++i) {
+        EXPECT_EQ(s21_vec[i + 2], source[i]);
+    }
+}
+
+TEST(VectorTests, Assign) {
+    containers::vector<std::string> s21_vec = {"a", "b", "c"};
+    std::vector<std::string> std_vec = {"a", "b", "c"};
+    std::vector<std::string> source = {"x", "y"};
+
+    s21_vec.assign(source.begin(), source.end());
+    std_vec.assign(source.begin(), source.end());
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    EXPECT_EQ(s21_vec.capacity(), 3U);
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+
+    std::list<std::string> longer(10, "z");
+    s21_vec.assign(longer.begin(), longer.end());
+    std_vec.assign(longer.begin(), longer.end());
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    EXPECT_EQ(s21_vec.capacity(), 10U);
+    for (size_t i = 0; i < s21_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(VectorTests, OneAndHalfGrowth) {
+    containers::vector<int, std::allocator<int>, containers::one_and_half_growth> s21_vec;
+    std::vector<size_t> capacities;
+    for (int i = 0; i < 20; ++i) {
+        s21_vec.push_back(i);
+        if (capacities.empty() || capacities.back() != s21_vec.capacity()) {
+            capacities.push_back(s21_vec.capacity());
+        }
+    }
+    std::vector<size_t> expected = {1, 2, 3, 4, 6, 9, 13, 19, 28};
+    EXPECT_EQ(capacities, expected);
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(s21_vec[i], i);
+    }
+}
+
+TEST(VectorTests, PageRoundedGrowth) {
+    containers::vector<int, std::allocator<int>, containers::page_rounded_growth<>> s21_vec;
+    for (int i = 0; i < 3000; ++i) {
+        s21_vec.push_back(i);
+        if (s21_vec.capacity() * sizeof(int) >= 4096) {
+            EXPECT_EQ(s21_vec.capacity() * sizeof(int) % 4096, 0U);
+        }
+    }
+    EXPECT_EQ(s21_vec.capacity(), 4096U);
+    EXPECT_EQ(s21_vec[2999], 2999);
+}
+
+TEST(VectorTests, SizeClassGrowth) {
+    using policy = containers::size_class_growth<containers::one_and_half_growth>;
+    EXPECT_EQ(policy::size_class(1), 16U);
+    EXPECT_EQ(policy::size_class(20), 20U);
+    EXPECT_EQ(policy::size_class(33), 40U);
+    EXPECT_EQ(policy::size_class(4097), 5120U);
+
+    containers::vector<double, std::allocator<double>, policy> s21_vec;
+    for (int i = 0; i < 1000; ++i) {
+        s21_vec.push_back(i);
+        size_t bytes = s21_vec.capacity() * sizeof(double);
+        EXPECT_EQ(policy::size_class(bytes), bytes);
+    }
+    EXPECT_EQ(s21_vec.size(), 1000U);
+    EXPECT_EQ(s21_vec[999], 999);
+}
+
+TEST(VectorTests, MmapAllocatorReallocate) {
+    containers::mmap_allocator<int, false, 4096> allocator;
+    int *data = allocator.allocate(100);  // below the threshold
+    for (int i = 0; i < 100; ++i) data[i] = i;
+    data = allocator.reallocate(data, 100, 5000);  // moves into a mapping
+    for (int i = 100; i < 5000; ++i) data[i] = i;
+    data = allocator.reallocate(data, 5000, 100000);  // grows the mapping
+    for (int i = 0; i < 5000; ++i) EXPECT_EQ(data[i], i);
+    data = allocator.reallocate(data, 100000, 10);  // back to the heap
+    for (int i = 0; i < 10; ++i) EXPECT_EQ(data[i], i);
+    allocator.deallocate(data, 10);
+}
+
+TEST(VectorTests, MmapAllocatorHugeVector) {
+    containers::vector<int, containers::mmap_allocator<int, true>> s21_vec;
+    std::vector<int> std_vec;
+    for (int i = 0; i < 1000000; ++i) {
+        s21_vec.push_back(i);
+        std_vec.push_back(i);
+    }
+    s21_vec.push_back(s21_vec[0]);  // the argument lives in the buffer being resized
+    std_vec.push_back(std_vec[0]);
+    s21_vec.insert(s21_vec.begin() + 1, s21_vec.back());
+    std_vec.insert(std_vec.begin() + 1, std_vec.back());
+    s21_vec.reserve(4000000);
+    EXPECT_EQ(s21_vec.capacity(), 4000000U);
+    s21_vec.shrink_to_fit();
+    EXPECT_EQ(s21_vec.capacity(), s21_vec.size());
+    ASSERT_EQ(s21_vec.size(), std_vec.size());
+    for (size_t i = 0; i < std_vec.size(); ++i) {
+        ASSERT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(VectorTests, MmapAllocatorNonTrivialElements) {
+    containers::vector<std::string, containers::mmap_allocator<std::string, false, 4096>> s21_vec;
+    std::vector<std::string> std_vec;
+    for (int i = 0; i < 1000; ++i) {
+        s21_vec.push_back(std::to_string(i) + " is long enough to leave the small buffer");
+        std_vec.push_back(std::to_string(i) + " is long enough to leave the small buffer");
+    }
+    s21_vec.shrink_to_fit();
+    for (size_t i = 0; i < std_vec.size(); ++i) {
+        EXPECT_EQ(s21_vec[i], std_vec[i]);
+    }
+}
+
+TEST(VectorTests, MmapAllocatorOverAlignedElements) {
+    struct alignas(64) line {
+        int value;
+    };
+    containers::vector<line, containers::mmap_allocator<line, false, 4096>> s21_vec;
+    for (int i = 0; i < 200; ++i) {
+        s21_vec.push_back({i});
+        // the first blocks come from operator new, the later ones are mappings
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21_vec.data()) % alignof(line), 0U);
+    }
+    s21_vec.shrink_to_fit();
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21_vec.data()) % alignof(line), 0U);
+    for (int i = 0; i < 200; ++i) EXPECT_EQ(s21_vec[i].value, i);
+}
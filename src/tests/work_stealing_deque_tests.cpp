@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../library/work_stealing_deque.h"
+
+TEST(WorkStealingDequeTests, OwnerIsLifoThievesAreFifo) {
+    containers::work_stealing_deque<int> s21_deq(4);
+    EXPECT_TRUE(s21_deq.empty());
+    for (int i = 0; i < 5; ++i) s21_deq.push(i);
+    EXPECT_EQ(s21_deq.size(), 5U);
+    int value = -1;
+    EXPECT_TRUE(s21_deq.pop(value));
+    EXPECT_EQ(value, 4);
+    EXPECT_TRUE(s21_deq.steal(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(s21_deq.steal(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(s21_deq.pop(value));
+    EXPECT_EQ(value, 3);
+    EXPECT_TRUE(s21_deq.pop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(s21_deq.pop(value));
+    EXPECT_FALSE(s21_deq.steal(value));
+    EXPECT_TRUE(s21_deq.empty());
+    EXPECT_THROW(containers::work_stealing_deque<int>(0), std::length_error);
+}
+
+TEST(WorkStealingDequeTests, GrowsKeepingTheElements) {
+    containers::work_stealing_deque<long> s21_deq(2);
+    for (long round = 0; round < 3; ++round) {
+        // shift the positions so the copy wraps around the ring
+        s21_deq.push(-1);
+        long value;
+        s21_deq.steal(value);
+        for (long i = 0; i < 100; ++i) s21_deq.push(i);
+        EXPECT_GE(s21_deq.capacity(), 100U);
+        for (long i = 0; i < 50; ++i) {
+            ASSERT_TRUE(s21_deq.steal(value));
+            ASSERT_EQ(value, i);
+        }
+        for (long i = 99; i >= 50; --i) {
+            ASSERT_TRUE(s21_deq.pop(value));
+            ASSERT_EQ(value, i);
+        }
+    }
+}
+
+TEST(WorkStealingDequeTests, OwnerAndThievesThreads) {
+    constexpr long kCount = 20000;
+    constexpr int kThieves = 3;
+    containers::work_stealing_deque<long> s21_deq(8);
+    std::atomic<bool> done{false};
+    std::vector<long> sums(kThieves + 1, 0);
+    std::vector<long> counts(kThieves + 1, 0);
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < kThieves; ++t) {
+        thieves.emplace_back([&, t] {
+            long value;
+            while (!done.load()) {
+                if (s21_deq.steal(value)) {
+                    sums[t] += value;
+                    ++counts[t];
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    // the owner pushes in bursts and pops part of each burst itself
+    long value;
+    for (long i = 0; i < kCount;) {
+        for (long j = 0; j < 16 && i < kCount; ++j) s21_deq.push(i++);
+        for (int j = 0; j < 6 && s21_deq.pop(value); ++j) {
+            sums[kThieves] += value;
+            ++counts[kThieves];
+        }
+        std::this_thread::yield();
+    }
+    while (s21_deq.pop(value)) {
+        sums[kThieves] += value;
+        ++counts[kThieves];
+    }
+    done.store(true);
+    for (auto &thief : thieves) thief.join();
+
+    long sum = 0;
+    long count = 0;
+    for (int t = 0; t <= kThieves; ++t) {
+        sum += sums[t];
+        count += counts[t];
+    }
+    EXPECT_EQ(count, kCount);
+    EXPECT_EQ(sum, kCount * (kCount - 1) / 2);
+}